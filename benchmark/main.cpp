@@ -296,7 +296,29 @@ VideoFrameWrapper GetPlanar44410BitFrame(uint32_t width, uint32_t height)
     };
 }
 
-VideoFrameWrapper Get10BitXRGBBEBuffer(uint32_t width, uint32_t height)
+VideoFrameWrapper GetARGBFrame(uint32_t width, uint32_t height)
+{
+    const uint32_t bufferSize = (height * width) * 4;
+    uint8_t* buffer = new uint8_t[bufferSize];
+    for (uint32_t sampleIndex = 0; sampleIndex < width * height; ++sampleIndex) {
+        buffer[sampleIndex * 4] = 0xFF;
+        buffer[sampleIndex * 4 + 1] = 0xFF;
+        buffer[sampleIndex * 4 + 2] = 0xFF;
+        buffer[sampleIndex * 4 + 3] = 0xFF;
+    }
+    return VideoFrameWrapper{
+        .buffer = buffer,
+        .stride = width * 4,
+        .chromaStride = 0,
+        .width = width,
+        .height = height,
+        .pixelFormat = PixelFormat::RGB8BitInterleavedARGB,
+        .isVideoFullRange = true,
+        .lumaChromaMatrix = LumaChromaMatrix::Identity,
+    };
+}
+
+VideoFrameWrapper Get10BitRGBBuffer(PixelFormat pixelFormat, uint32_t width, uint32_t height)
 {
     const uint32_t bufferSize = width * height;
     uint32_t* buffer = new uint32_t[bufferSize];
@@ -309,7 +331,28 @@ VideoFrameWrapper Get10BitXRGBBEBuffer(uint32_t width, uint32_t height)
         .chromaStride = 0,
         .width = width,
         .height = height,
-        .pixelFormat = PixelFormat::RGB10BitInterleavedXRGBBE,
+        .pixelFormat = pixelFormat,
+        .isVideoFullRange = false,
+        .lumaChromaMatrix = LumaChromaMatrix::Identity,
+    };
+}
+
+VideoFrameWrapper Get12BitBGRBuffer(PixelFormat pixelFormat, uint32_t width, uint32_t height)
+{
+    // Lines hold whole groups of 8 pixels in 36 bytes
+    const uint32_t stride = ((width + 7) / 8) * 36;
+    const uint32_t bufferSize = stride * height;
+    uint8_t* buffer = new uint8_t[bufferSize];
+    for (uint32_t bufferIndex = 0; bufferIndex < bufferSize; ++bufferIndex) {
+        buffer[bufferIndex] = 0;
+    }
+    return VideoFrameWrapper{
+        .buffer = buffer,
+        .stride = stride,
+        .chromaStride = 0,
+        .width = width,
+        .height = height,
+        .pixelFormat = pixelFormat,
         .isVideoFullRange = false,
         .lumaChromaMatrix = LumaChromaMatrix::Identity,
     };
@@ -338,7 +381,7 @@ VideoFrameWrapper GetP216Frame(uint32_t width, uint32_t height)
     return VideoFrameWrapper{
         .buffer = reinterpret_cast<uint8_t*>(buffer),
         .stride = width * 2,
-        .chromaStride = 0,
+        .chromaStride = chromaWidth * 2,
         .width = width,
         .height = height,
         .pixelFormat = PixelFormat::YCC16Bit422BiplanarP216,
@@ -367,17 +410,176 @@ VideoFrameWrapper GetV210Buffer(uint32_t width, uint32_t height)
     };
 }
 
+VideoFrameWrapper GetYUY2Frame(uint32_t width, uint32_t height)
+{
+    const uint32_t stride = ((width + 1) / 2) * 4;
+    const uint32_t bufferSize = height * stride;
+    uint8_t* buffer = new uint8_t[bufferSize];
+    for (uint32_t x = 0; x < ((width + 1) / 2); ++x) {
+        for (uint32_t y = 0; y < height; ++y) {
+            const uint32_t baseIndex = y * stride + x * 4;
+            buffer[baseIndex] = 0xFF;      // Y
+            buffer[baseIndex + 1] = 0xB0;  // U
+            buffer[baseIndex + 2] = 0xFF;  // Y
+            buffer[baseIndex + 3] = 0xC0;  // V
+        }
+    }
+    return VideoFrameWrapper{
+        .buffer = buffer,
+        .stride = stride,
+        .chromaStride = 0,
+        .width = width,
+        .height = height,
+        .pixelFormat = PixelFormat::YCC8Bit422InterleavedYUY2,
+        .isVideoFullRange = false,
+        .lumaChromaMatrix = LumaChromaMatrix::BT709,
+    };
+}
+
+VideoFrameWrapper GetY210Frame(uint32_t width, uint32_t height)
+{
+    const uint32_t stride = ((width + 1) / 2) * 8;
+    const uint32_t bufferSize = height * stride / 2;
+    uint16_t* buffer = new uint16_t[bufferSize];
+    for (uint32_t macropixelIndex = 0; macropixelIndex < bufferSize / 4; ++macropixelIndex) {
+        buffer[macropixelIndex * 4] = 0x3AC << 6;      // Y
+        buffer[macropixelIndex * 4 + 1] = 0x2C0 << 6;  // U
+        buffer[macropixelIndex * 4 + 2] = 0x3AC << 6;  // Y
+        buffer[macropixelIndex * 4 + 3] = 0x300 << 6;  // V
+    }
+    return VideoFrameWrapper{
+        .buffer = reinterpret_cast<uint8_t*>(buffer),
+        .stride = stride,
+        .chromaStride = 0,
+        .width = width,
+        .height = height,
+        .pixelFormat = PixelFormat::YCC10Bit422InterleavedY210,
+        .isVideoFullRange = false,
+        .lumaChromaMatrix = LumaChromaMatrix::BT709,
+    };
+}
+
+VideoFrameWrapper GetV410Frame(uint32_t width, uint32_t height)
+{
+    const uint32_t bufferSize = width * height;
+    uint32_t* buffer = new uint32_t[bufferSize];
+    for (uint32_t bufferIndex = 0; bufferIndex < bufferSize; ++bufferIndex) {
+        buffer[bufferIndex] = (0x2C0 << 2) | (0x3AC << 12) | (0x300 << 22);
+    }
+    return VideoFrameWrapper{
+        .buffer = reinterpret_cast<uint8_t*>(buffer),
+        .stride = width * 4,
+        .chromaStride = 0,
+        .width = width,
+        .height = height,
+        .pixelFormat = PixelFormat::YCC10Bit444InterleavedV410,
+        .isVideoFullRange = false,
+        .lumaChromaMatrix = LumaChromaMatrix::BT709,
+    };
+}
+
+VideoFrameWrapper Get24BitRGBFrame(PixelFormat pixelFormat, uint32_t width, uint32_t height)
+{
+    const uint32_t bufferSize = (height * width) * 3;
+    uint8_t* buffer = new uint8_t[bufferSize];
+    for (uint32_t sampleIndex = 0; sampleIndex < width * height; ++sampleIndex) {
+        buffer[sampleIndex * 3] = 0xFF;
+        buffer[sampleIndex * 3 + 1] = 0x80;
+        buffer[sampleIndex * 3 + 2] = 0x00;
+    }
+    return VideoFrameWrapper{
+        .buffer = buffer,
+        .stride = width * 3,
+        .chromaStride = 0,
+        .width = width,
+        .height = height,
+        .pixelFormat = pixelFormat,
+        .isVideoFullRange = true,
+        .lumaChromaMatrix = LumaChromaMatrix::Identity,
+    };
+}
+
+VideoFrameWrapper GetRGB48Frame(uint32_t width, uint32_t height)
+{
+    const uint32_t bufferSize = (height * width) * 3;
+    uint16_t* buffer = new uint16_t[bufferSize];
+    for (uint32_t sampleIndex = 0; sampleIndex < width * height; ++sampleIndex) {
+        buffer[sampleIndex * 3] = 0xFFFF;
+        buffer[sampleIndex * 3 + 1] = 0x8000;
+        buffer[sampleIndex * 3 + 2] = 0x0000;
+    }
+    return VideoFrameWrapper{
+        .buffer = reinterpret_cast<uint8_t*>(buffer),
+        .stride = width * 6,
+        .chromaStride = 0,
+        .width = width,
+        .height = height,
+        .pixelFormat = PixelFormat::RGB16BitInterleavedRGB,
+        .isVideoFullRange = true,
+        .lumaChromaMatrix = LumaChromaMatrix::Identity,
+    };
+}
+
+VideoFrameWrapper GetYUVAFrame(PixelFormat pixelFormat, uint32_t width, uint32_t height)
+{
+    const bool is420 = pixelFormat == PixelFormat::YCCA8Bit420Planar;
+    const uint32_t chromaWidth = is420 ? (width + 1) / 2 : width;
+    const uint32_t chromaHeight = is420 ? (height + 1) / 2 : height;
+    const uint32_t lumaSize = width * height;
+    const uint32_t chromaSize = chromaWidth * chromaHeight;
+    const uint32_t bufferSize = lumaSize * 2 + chromaSize * 2;
+    uint8_t* buffer = new uint8_t[bufferSize];
+    for (uint32_t sampleIndex = 0; sampleIndex < lumaSize; ++sampleIndex) {
+        buffer[sampleIndex] = 0xEB;
+        buffer[lumaSize + chromaSize * 2 + sampleIndex] = static_cast<uint8_t>(sampleIndex % 256);
+    }
+    for (uint32_t sampleIndex = 0; sampleIndex < chromaSize * 2; ++sampleIndex) {
+        buffer[lumaSize + sampleIndex] = 0x80;
+    }
+    return VideoFrameWrapper{
+        .buffer = buffer,
+        .stride = width,
+        .chromaStride = chromaWidth,
+        .width = width,
+        .height = height,
+        .pixelFormat = pixelFormat,
+        .isVideoFullRange = false,
+        .lumaChromaMatrix = LumaChromaMatrix::BT709,
+    };
+}
+
+VideoFrameWrapper GetPlanarRGBFrame(PixelFormat pixelFormat, uint32_t width, uint32_t height)
+{
+    uint32_t sampleSize = 1;
+    if (pixelFormat == PixelFormat::RGB16BitPlanarGBR || pixelFormat == PixelFormat::RGBFloat16PlanarNCHW) {
+        sampleSize = 2;
+    } else if (pixelFormat == PixelFormat::RGBFloat32PlanarNCHW) {
+        sampleSize = 4;
+    }
+    const uint32_t bufferSize = (height * width) * sampleSize * 3;
+    uint8_t* buffer = new uint8_t[bufferSize];
+    return VideoFrameWrapper{
+        .buffer = buffer,
+        .stride = width * sampleSize,
+        .chromaStride = width * sampleSize,
+        .width = width,
+        .height = height,
+        .pixelFormat = pixelFormat,
+        .isVideoFullRange = true,
+        .lumaChromaMatrix = LumaChromaMatrix::Identity,
+    };
+}
+
 VideoFrameWrapper CreateFrame(PixelFormat pixelFormat, uint32_t width, uint32_t height)
 {
-    static_assert(AllPixelFormats.size() == 25);
+    static_assert(AllPixelFormats.size() == 37);
     switch (pixelFormat) {
         case PixelFormat::RGB8BitInterleavedBGRA:
             return GetBGRAFrame(width, height);
         case PixelFormat::RGB8BitInterleavedRGBA:
             return GetRGBAFrame(width, height);
         case PixelFormat::RGB8BitInterleavedARGB:
-            // TODO
-            return VideoFrameWrapper{};
+            return GetARGBFrame(width, height);
         case PixelFormat::YCC8Bit420Planar:
             return GetPlanar420Frame(width, height);
         case PixelFormat::YCC8Bit420PlanarYV12:
@@ -391,22 +593,12 @@ VideoFrameWrapper CreateFrame(PixelFormat pixelFormat, uint32_t width, uint32_t
         case PixelFormat::YCC8Bit422InterleavedUYVY:
             return GetUYVYFrame(width, height);
         case PixelFormat::RGB10BitInterleavedRGBXBE:
-            // TODO
-            return VideoFrameWrapper{};
         case PixelFormat::RGB10BitInterleavedRGBXLE:
-            // TODO
-            return VideoFrameWrapper{};
         case PixelFormat::RGB10BitInterleavedXRGBBE:
-            return Get10BitXRGBBEBuffer(width, height);
         case PixelFormat::RGB10BitInterleavedXRGBLE:
-            // TODO
-            return VideoFrameWrapper{};
         case PixelFormat::RGB10BitInterleavedXBGRBE:
-            // TODO
-            return VideoFrameWrapper{};
         case PixelFormat::RGB10BitInterleavedXBGRLE:
-            // TODO
-            return VideoFrameWrapper{};
+            return Get10BitRGBBuffer(pixelFormat, width, height);
         case PixelFormat::YCC10Bit420Planar:
             return GetPlanar42010BitFrame(width, height);
         case PixelFormat::YCC10Bit422Planar:
@@ -425,13 +617,29 @@ VideoFrameWrapper CreateFrame(PixelFormat pixelFormat, uint32_t width, uint32_t
         case PixelFormat::YCC10Bit422InterleavedV210:
             return GetV210Buffer(width, height);
         case PixelFormat::RGB12BitInterleavedBGRBE:
-            // TODO
-            return VideoFrameWrapper{};
         case PixelFormat::RGB12BitInterleavedBGRLE:
-            // TODO
-            return VideoFrameWrapper{};
+            return Get12BitBGRBuffer(pixelFormat, width, height);
         case PixelFormat::YCC16Bit422BiplanarP216:
             return GetP216Frame(width, height);
+        case PixelFormat::YCC8Bit422InterleavedYUY2:
+            return GetYUY2Frame(width, height);
+        case PixelFormat::YCC10Bit422InterleavedY210:
+            return GetY210Frame(width, height);
+        case PixelFormat::YCC10Bit444InterleavedV410:
+            return GetV410Frame(width, height);
+        case PixelFormat::RGB8BitInterleavedRGB:
+        case PixelFormat::RGB8BitInterleavedBGR:
+            return Get24BitRGBFrame(pixelFormat, width, height);
+        case PixelFormat::RGB16BitInterleavedRGB:
+            return GetRGB48Frame(width, height);
+        case PixelFormat::YCCA8Bit420Planar:
+        case PixelFormat::YCCA8Bit444Planar:
+            return GetYUVAFrame(pixelFormat, width, height);
+        case PixelFormat::RGB8BitPlanarGBR:
+        case PixelFormat::RGB16BitPlanarGBR:
+        case PixelFormat::RGBFloat16PlanarNCHW:
+        case PixelFormat::RGBFloat32PlanarNCHW:
+            return GetPlanarRGBFrame(pixelFormat, width, height);
         default:
             return VideoFrameWrapper{};
     }
@@ -439,7 +647,7 @@ VideoFrameWrapper CreateFrame(PixelFormat pixelFormat, uint32_t width, uint32_t
 
 std::string GetFormatName(PixelFormat pixelFormat)
 {
-    static_assert(AllPixelFormats.size() == 25);
+    static_assert(AllPixelFormats.size() == 37);
     switch (pixelFormat) {
         case PixelFormat::RGB8BitInterleavedBGRA:
             return "RGB8BitInterleavedBGRA";
@@ -491,6 +699,30 @@ std::string GetFormatName(PixelFormat pixelFormat)
             return "RGB12BitInterleavedBGRLE";
         case PixelFormat::YCC16Bit422BiplanarP216:
             return "YCC16Bit422BiplanarP216";
+        case PixelFormat::YCC8Bit422InterleavedYUY2:
+            return "YCC8Bit422InterleavedYUY2";
+        case PixelFormat::YCC10Bit422InterleavedY210:
+            return "YCC10Bit422InterleavedY210";
+        case PixelFormat::YCC10Bit444InterleavedV410:
+            return "YCC10Bit444InterleavedV410";
+        case PixelFormat::RGB8BitInterleavedRGB:
+            return "RGB8BitInterleavedRGB";
+        case PixelFormat::RGB8BitInterleavedBGR:
+            return "RGB8BitInterleavedBGR";
+        case PixelFormat::RGB16BitInterleavedRGB:
+            return "RGB16BitInterleavedRGB";
+        case PixelFormat::YCCA8Bit420Planar:
+            return "YCCA8Bit420Planar";
+        case PixelFormat::YCCA8Bit444Planar:
+            return "YCCA8Bit444Planar";
+        case PixelFormat::RGB8BitPlanarGBR:
+            return "RGB8BitPlanarGBR";
+        case PixelFormat::RGB16BitPlanarGBR:
+            return "RGB16BitPlanarGBR";
+        case PixelFormat::RGBFloat16PlanarNCHW:
+            return "RGBFloat16PlanarNCHW";
+        case PixelFormat::RGBFloat32PlanarNCHW:
+            return "RGBFloat32PlanarNCHW";
         default:
             return "";
     }
@@ -506,29 +738,63 @@ int main()
     std::vector<PixelFormat> validInputFormats{
         PixelFormat::RGB8BitInterleavedBGRA,
         PixelFormat::RGB8BitInterleavedRGBA,
+        PixelFormat::RGB8BitInterleavedARGB,
         PixelFormat::YCC8Bit420Planar,
         PixelFormat::YCC8Bit420PlanarYV12,
         PixelFormat::YCC8Bit422Planar,
         PixelFormat::YCC8Bit444Planar,
         PixelFormat::YCC8Bit420BiplanarNV12,
         PixelFormat::YCC8Bit422InterleavedUYVY,
+        PixelFormat::RGB10BitInterleavedRGBXBE,
+        PixelFormat::RGB10BitInterleavedRGBXLE,
         PixelFormat::RGB10BitInterleavedXRGBBE,
+        PixelFormat::RGB10BitInterleavedXRGBLE,
+        PixelFormat::RGB10BitInterleavedXBGRBE,
+        PixelFormat::RGB10BitInterleavedXBGRLE,
         PixelFormat::YCC10Bit420Planar,
         PixelFormat::YCC10Bit422Planar,
         PixelFormat::YCC10Bit444Planar,
+        PixelFormat::RGB12BitInterleavedBGRBE,
+        PixelFormat::RGB12BitInterleavedBGRLE,
         PixelFormat::YCC16Bit422BiplanarP216,
+        PixelFormat::YCC8Bit422InterleavedYUY2,
+        PixelFormat::YCC10Bit422InterleavedY210,
+        PixelFormat::YCC10Bit444InterleavedV410,
+        PixelFormat::RGB8BitInterleavedRGB,
+        PixelFormat::RGB8BitInterleavedBGR,
+        PixelFormat::RGB16BitInterleavedRGB,
+        PixelFormat::YCCA8Bit420Planar,
+        PixelFormat::YCCA8Bit444Planar,
     };
 
     std::vector<PixelFormat> validOutputFormats{
         PixelFormat::RGB8BitInterleavedBGRA,
+        PixelFormat::RGB8BitInterleavedRGBA,
+        PixelFormat::RGB8BitInterleavedARGB,
         PixelFormat::YCC8Bit420Planar,
         PixelFormat::YCC8Bit422Planar,
         PixelFormat::YCC8Bit444Planar,
+        PixelFormat::YCC8Bit420BiplanarNV12,
         PixelFormat::YCC8Bit422InterleavedUYVY,
+        PixelFormat::RGB10BitInterleavedRGBXBE,
+        PixelFormat::RGB10BitInterleavedRGBXLE,
         PixelFormat::RGB10BitInterleavedXRGBBE,
+        PixelFormat::RGB10BitInterleavedXRGBLE,
+        PixelFormat::RGB10BitInterleavedXBGRBE,
+        PixelFormat::RGB10BitInterleavedXBGRLE,
         PixelFormat::YCC10Bit420Planar,
         PixelFormat::YCC10Bit422Planar,
         PixelFormat::YCC10Bit444Planar,
+        PixelFormat::YCC10Bit422InterleavedV210,
+        PixelFormat::RGB12BitInterleavedBGRBE,
+        PixelFormat::RGB12BitInterleavedBGRLE,
+        PixelFormat::YCC16Bit422BiplanarP216,
+        PixelFormat::YCCA8Bit420Planar,
+        PixelFormat::YCCA8Bit444Planar,
+        PixelFormat::RGB8BitPlanarGBR,
+        PixelFormat::RGB16BitPlanarGBR,
+        PixelFormat::RGBFloat16PlanarNCHW,
+        PixelFormat::RGBFloat32PlanarNCHW,
     };
 
     struct Resolution {
@@ -540,9 +806,15 @@ int main()
         Resolution{1920, 1080},
         Resolution{1280, 720}};
 
+    // Scaled conversions are also measured without sampled images, to compare the texture and buffer paths. The path
+    // column reports the one each conversion actually took.
     const auto videoConverter = device->CreateVideoConverter();
+    VideoConverterConfig bufferPathConfig;
+    bufferPathConfig.allowSampledImages = false;
+    const auto bufferPathVideoConverter = device->CreateVideoConverter(bufferPathConfig);
 
     struct BenchmarkResult {
+        std::string path;
         PixelFormat inputFormat;
         uint32_t inputWidth;
         uint32_t inputHeight;
@@ -563,8 +835,15 @@ int main()
                 for (PixelFormat outputFormat : validOutputFormats) {
                     VideoFrameWrapper outputFrame =
                         CreateFrame(outputFormat, outputResolution.width, outputResolution.height);
-                    {
+                    // The default converter falls back to buffers on its own, the buffer path is only measured
+                    // again when it chose sampled images
+                    bool usedSampledImages = false;
+                    for (const auto converter : {videoConverter, bufferPathVideoConverter}) {
+                        if (converter == bufferPathVideoConverter && !usedSampledImages) {
+                            continue;
+                        }
                         BenchmarkResult benchmarkResult{
+                            "",
                             inputFormat,
                             inputResolution.width,
                             inputResolution.height,
@@ -577,14 +856,17 @@ int main()
                                   << outputResolution.height << ")" << std::endl;
                         constexpr uint32_t iterations = 10;
                         for (uint32_t i = 0; i < iterations + 1; ++i) {
-                            auto resultAndBenchmark = videoConverter->ConvertWithBenchmark(inputFrame, outputFrame);
+                            auto resultAndBenchmark = converter->ConvertWithBenchmark(inputFrame, outputFrame);
                             if (resultAndBenchmark.result != Result::Success) {
                                 std::cout << "Error converting frame" << std::endl;
                                 while (true)
                                     ;
                             }
 
-                            if (i > 0) {
+                            if (i == 0) {
+                                usedSampledImages = resultAndBenchmark.value.usedSampledImages;
+                                benchmarkResult.path = usedSampledImages ? "SampledImage" : "Buffer";
+                            } else {
                                 benchmarkResult.copyToDeviceVisibleTimeMicros +=
                                     resultAndBenchmark.value.copyToDeviceVisibleTimeMicros;
                                 benchmarkResult.transferDeviceVisibleToDeviceLocalTimeMicros +=
@@ -611,15 +893,15 @@ int main()
     std::fstream benchmarkStream;
     const std::string separator = ",";
     benchmarkStream.open("benchmark.csv", std::ios::out);
-    benchmarkStream << "InputFormat" << separator << "InputWidth" << separator << "InputHeight" << separator
-                    << "OutputFormat" << separator << "OutputWidth" << separator << "OutputHeight" << separator
-                    << "CopyToDeviceVisibleTimeMicros" << separator << "TransferDeviceVisibleToDeviceLocalTimeMicros"
-                    << separator << "ComputeConversionTimeMicros" << separator
-                    << "CopyDeviceVisibleToHostLocalTimeMicros" << separator << "TotalTime" << std::endl;
+    benchmarkStream << "Path" << separator << "InputFormat" << separator << "InputWidth" << separator << "InputHeight"
+                    << separator << "OutputFormat" << separator << "OutputWidth" << separator << "OutputHeight"
+                    << separator << "CopyToDeviceVisibleTimeMicros" << separator
+                    << "TransferDeviceVisibleToDeviceLocalTimeMicros" << separator << "ComputeConversionTimeMicros"
+                    << separator << "CopyDeviceVisibleToHostLocalTimeMicros" << separator << "TotalTime" << std::endl;
 
     for (const BenchmarkResult& benchmarkResult : results) {
-        benchmarkStream << GetFormatName(benchmarkResult.inputFormat) << separator << benchmarkResult.inputWidth
-                        << separator << benchmarkResult.inputHeight << separator
+        benchmarkStream << benchmarkResult.path << separator << GetFormatName(benchmarkResult.inputFormat) << separator
+                        << benchmarkResult.inputWidth << separator << benchmarkResult.inputHeight << separator
                         << GetFormatName(benchmarkResult.outputFormat) << separator << benchmarkResult.outputWidth
                         << separator << benchmarkResult.outputHeight << separator
                         << benchmarkResult.copyToDeviceVisibleTimeMicros << separator
@@ -634,6 +916,7 @@ int main()
     }
     benchmarkStream.close();
 
+    bufferPathVideoConverter->Release();
     videoConverter->Release();
     device->Release();
     return 0;
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Macros.h"
+#include "Result.h"
+
+namespace Pixelweave
+{
+
+// 3D lookup table over full range RGB in [0, 1]. Entries are RGB triplets ordered with red varying fastest, then
+// green, then blue, as in .cube files.
+struct PIXELWEAVE_LIB_CLASS ColorLUT {
+    uint32_t size = 0;  // Points per axis, 0 leaves colors untouched
+#pragma warning(suppress : 4251)  // MSVC: suppress spurious MSVC warning caused by exporting `std::vector`
+    std::vector<float> entries;
+
+    bool IsEmpty() const;
+    bool IsValid() const;  // Whether the table is empty, or has at least two points per axis and all its entries
+
+    // Parses a .cube file holding a 3D table with the default [0, 1] input domain
+    static ResultValue<ColorLUT> LoadCube(const std::string& path);
+};
+
+}  // namespace Pixelweave
@@ -13,6 +13,12 @@ public:
     static ResultValue<Device*> Create();
 
     virtual VideoConverter* CreateVideoConverter() = 0;
+    virtual VideoConverter* CreateVideoConverter(const VideoConverterConfig& config) = 0;
+
+    // Whether converters can run half precision arithmetic, see `VideoConverterConfig::allowFloat16Arithmetic`
+    virtual bool SupportsFloat16Arithmetic() const = 0;
+    // Whether converters can resolve blocks across subgroup quads, see `VideoConverterConfig::allowSubgroupOperations`
+    virtual bool SupportsSubgroupQuadOperations() const = 0;
 
     virtual ~Device() = default;
 };
@@ -32,6 +32,18 @@ enum class PixelFormat : uint32_t {
     RGB12BitInterleavedBGRBE,    // Eight pixels in 36 bytes
     RGB12BitInterleavedBGRLE,
     YCC16Bit422BiplanarP216,
+    YCC8Bit422InterleavedYUY2,   // Y U Y V macropixels
+    YCC10Bit422InterleavedY210,  // Y U Y V macropixels, 10 bpc in upper bits of 16-bit segments
+    YCC10Bit444InterleavedV410,  // One 32-bit word per pixel, U Y V from bit 2 upwards
+    RGB8BitInterleavedRGB,       // Three bytes per pixel
+    RGB8BitInterleavedBGR,
+    RGB16BitInterleavedRGB,      // Three 16-bit segments per pixel
+    YCCA8Bit420Planar,           // Plane order YCbCrA, the alpha plane shares the luma stride
+    YCCA8Bit444Planar,
+    RGB8BitPlanarGBR,            // Plane order GBR, planes share the dimensions and stride of luma
+    RGB16BitPlanarGBR,
+    RGBFloat16PlanarNCHW,        // Plane order RGB, normalized with the converter's tensor scale and bias
+    RGBFloat32PlanarNCHW,
     ValueCount,  // Convenience value
 };
 
@@ -63,6 +75,18 @@ constexpr std::array<PixelFormat, PixelFormatCount> AllPixelFormats{
     PixelFormat::RGB12BitInterleavedBGRBE,
     PixelFormat::RGB12BitInterleavedBGRLE,
     PixelFormat::YCC16Bit422BiplanarP216,
+    PixelFormat::YCC8Bit422InterleavedYUY2,
+    PixelFormat::YCC10Bit422InterleavedY210,
+    PixelFormat::YCC10Bit444InterleavedV410,
+    PixelFormat::RGB8BitInterleavedRGB,
+    PixelFormat::RGB8BitInterleavedBGR,
+    PixelFormat::RGB16BitInterleavedRGB,
+    PixelFormat::YCCA8Bit420Planar,
+    PixelFormat::YCCA8Bit444Planar,
+    PixelFormat::RGB8BitPlanarGBR,
+    PixelFormat::RGB16BitPlanarGBR,
+    PixelFormat::RGBFloat16PlanarNCHW,
+    PixelFormat::RGBFloat32PlanarNCHW,
 };
 
 enum class ColorFormat : uint32_t {
@@ -16,7 +16,10 @@ enum class Result {
     NoSuitableDeviceError,
     AllocationFailed,
     ShaderCompilationFailed,
-    UnknownError
+    UnknownError,
+    InvalidColorLUTError,
+    InvalidOverlayError,
+    InvalidTileError
 };
 
 template <typename T>
@@ -1,9 +1,15 @@
 #pragma once
 
+#include <array>
+#include <vector>
+
 #include "Macros.h"
 #include "RefCountPtr.h"
 #include "Result.h"
+#include "VideoConverterConfig.h"
 #include "VideoFrameWrapper.h"
+#include "VideoOverlay.h"
+#include "VideoTile.h"
 
 namespace Pixelweave
 {
@@ -15,6 +21,37 @@ struct BenchmarkResult {
     uint64_t transferDeviceLocalToHostVisibleTimeMicros = 0;
     uint64_t gpuConversionTimeMicros = 0;
     uint64_t copyDeviceVisibleToHostLocalTimeMicros = 0;
+    // Whether sources were scaled from sampled images rather than filtered from storage buffers
+    bool usedSampledImages = false;
+};
+
+// Destination pixels converted from the source, leaving out the fill color around placements. Samples are taken as
+// written, after overlays and before chroma subsampling, and channels are Y, Cb and Cr for YUV destinations and R, G
+// and B for RGB ones.
+struct FrameStatistics {
+    // Luma scaled to 256 bins, RGB destinations use the BT.709 luma weights
+    std::array<uint32_t, 256> lumaHistogram = {};
+    std::array<uint32_t, 3> minSamples = {};
+    std::array<uint32_t, 3> maxSamples = {};
+    std::array<double, 3> meanSamples = {};
+    // Samples outside the nominal video range for video range YUV destinations, or clipped to the lowest and highest
+    // sample value for full range and RGB ones
+    uint32_t belowRangeSampleCount = 0;
+    uint32_t aboveRangeSampleCount = 0;
+    uint32_t pixelCount = 0;
+};
+
+// Side of the square destination tiles changes are detected in, tiles on the right and bottom edges are cut by them
+constexpr uint32_t ChangeDetectionTileSize = 64;
+
+// Destination tiles whose converted pixels differ from the previous frame. Every tile is changed on the first frame,
+// after the frame properties change and after overlays are set.
+struct FrameChanges {
+    uint32_t tileCountX = 0;
+    uint32_t tileCountY = 0;
+    // Bit `index % 8` of byte `index / 8` is set when the tile at `index = y * tileCountX + x` changed
+    std::vector<uint8_t> changedTileMask;
+    bool isFrameChanged = true;
 };
 
 class PIXELWEAVE_LIB_CLASS VideoConverter : public RefCountPtr
@@ -24,6 +61,20 @@ public:
 
     virtual Result Convert(const VideoFrameWrapper& src, VideoFrameWrapper& dst) = 0;
     virtual ResultValue<BenchmarkResult> ConvertWithBenchmark(const VideoFrameWrapper& src, VideoFrameWrapper& dst) = 0;
+
+    // Statistics of the last converted or composed frame, empty unless `VideoConverterConfig::collectStatistics` is set
+    virtual FrameStatistics GetFrameStatistics() const = 0;
+
+    // Changes of the last converted or composed frame, empty unless `VideoConverterConfig::detectChanges` is set
+    virtual FrameChanges GetFrameChanges() const = 0;
+
+    // Converts the frame of every tile into its rectangle of `dst` in a single submission, reading and scaling each
+    // one on its own. Pixels outside every tile get the fill color of `dst`, whose placement is ignored.
+    virtual Result Compose(const std::vector<VideoTile>& tiles, VideoFrameWrapper& dst) = 0;
+
+    // Replaces the overlays composited over every following conversion, bottom layer first, and uploads their pixels
+    // once. Set them again only when they change, an empty list removes them.
+    virtual Result SetOverlays(const std::vector<VideoOverlay>& overlays) = 0;
     virtual ~VideoConverter() override = default;
 };
 }  // namespace Pixelweave
\ No newline at end of file
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "ColorLUT.h"
+
+namespace Pixelweave
+{
+
+enum class ScalingFilter : uint32_t {
+    Bilinear,
+    Bicubic,
+    Lanczos3,
+    // Coverage weighted mean of the source footprint, meant for large reductions
+    Area,
+};
+
+enum class ToneMapping : uint32_t {
+    None,
+    // ITU-R BT.2390 EETF, a spline rolling off highlights in the PQ domain while leaving midtones untouched
+    BT2390,
+    // Filmic curve by John Hable, compresses the whole range
+    Hable,
+};
+
+enum class Dithering : uint32_t {
+    None,
+    // 8x8 Bayer matrix, a regular pattern that is cheap to compress
+    Ordered,
+    // 16x16 tiled blue noise, no visible structure
+    BlueNoise,
+};
+
+// How interlaced sources become progressive when the destination is progressive
+enum class Deinterlacing : uint32_t {
+    // Both fields are kept on their lines, sharp on still content but combing on motion
+    Weave,
+    // Only the first field is kept, lines of the second one are interpolated from the lines around them
+    Bob,
+    // Every line is blended with the lines of the other field around it, trading vertical detail for no combing
+    LinearBlend,
+};
+
+enum class OverlayBlending : uint32_t {
+    // Samples are mixed as encoded, like most graphics software does
+    Gamma,
+    // Samples are mixed in linear light, keeping antialiased edges even and SDR graphics at reference white in HDR
+    Linear,
+};
+
+// Per-converter options, fixed for the lifetime of a `VideoConverter`
+struct VideoConverterConfig {
+    // Run color and filter math in half precision when the device supports `shaderFloat16` and neither frame uses
+    // more than 10 bits per sample. Results stay within 1 LSB of the single precision path.
+    bool allowFloat16Arithmetic = true;
+
+    // Convert one pixel per invocation and resolve chroma subsampling and packed writes across subgroup quads when
+    // the device supports quad operations in compute shaders.
+    bool allowSubgroupOperations = true;
+
+    // Upload eligible source planes into images and scale with the texture units' bilinear filtering, instead of
+    // filtering storage buffer reads in the shader.
+    bool allowSampledImages = true;
+
+    // Filter used when source and destination sizes differ. Anything other than bilinear runs as two separable
+    // passes through an intermediate buffer, with weights computed once per frame configuration.
+    ScalingFilter scalingFilter = ScalingFilter::Bilinear;
+
+    // Per-channel normalization of float tensor outputs, applied in RGB order to samples in [0, 1] as
+    // `sample * scale + bias`. Mean and standard deviation normalization uses a scale of 1 / std and a bias of
+    // -mean / std.
+    std::array<float, 3> tensorScale = {1.0f, 1.0f, 1.0f};
+    std::array<float, 3> tensorBias = {0.0f, 0.0f, 0.0f};
+
+    // Operator compressing highlights into the destination peak when the transfer function or primaries change, applied
+    // to the largest RGB component in linear light so hues are preserved. Peaks are in cd/m2, with SDR reference white
+    // at 203 cd/m2 as in ITU-R BT.2390, so SDR destinations peak at 203.
+    ToneMapping toneMapping = ToneMapping::None;
+    float toneMappingSourcePeak = 1000.0f;
+    float toneMappingTargetPeak = 203.0f;
+
+    // Threshold pattern added before samples are rounded to the destination bit depth, hiding banding when 10 bit and
+    // higher sources are reduced to 8 bits or when color conversions stretch gradients.
+    Dithering dithering = Dithering::None;
+
+    // Applied in the same pass, before scaling, when converting an interlaced source into a progressive destination
+    Deinterlacing deinterlacing = Deinterlacing::Weave;
+
+    // Space overlays set with `VideoConverter::SetOverlays` are composited in, over the converted and placed pixels
+    OverlayBlending overlayBlending = OverlayBlending::Gamma;
+
+    // Accumulate `FrameStatistics` of every destination frame in the conversion pass, read back with the frame and
+    // returned by `VideoConverter::GetFrameStatistics`
+    bool collectStatistics = false;
+
+    // Hash destination tiles in the conversion pass and compare them with the previous frame, reporting the changed
+    // ones through `VideoConverter::GetFrameChanges`. Pixels are compared after conversion and overlays, so changes
+    // the destination can't represent are ignored. Hashes are 32 bits, collisions are possible but unlikely.
+    bool detectChanges = false;
+    // Leave the destination buffer untouched when no tile changed and it's the buffer the previous frame was copied
+    // into, skipping the copy of the frame
+    bool skipUnchangedFrameReadback = false;
+
+    // Applied to full range RGB with tetrahedral interpolation, after conversion to the destination transfer function
+    // and primaries and before encoding into the destination matrix and range. The table is uploaded once per
+    // converter.
+    ColorLUT colorLUT;
+};
+
+}  // namespace Pixelweave
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <cstdint>
 #include <vector>
 
@@ -16,12 +17,60 @@ enum class LumaChromaMatrix {
     BT2020NCL = 9,
 };
 
+// Values match Rec. ITU-T H.273 transfer characteristics
+enum class TransferFunction {
+    BT709 = 1,  // SDR, decoded with the BT.1886 display gamma
+    PQ = 16,    // SMPTE ST 2084
+    HLG = 18,   // ARIB STD-B67
+};
+
+// Values match Rec. ITU-T H.273 colour primaries, all with a D65 white point
+enum class ColorPrimaries {
+    BT709 = 1,
+    BT2020 = 9,
+};
+
+// Position of subsampled chroma samples relative to luma, values match `chroma_sample_loc_type` in the H.264 and H.265
+// VUI. Only subsampled directions are affected, 4:2:2 frames just tell left from center.
+enum class ChromaSiting : uint32_t {
+    Left = 0,     // Co-sited horizontally, centered vertically: MPEG-2, H.264 and H.265 4:2:0, and most 4:2:2
+    Center = 1,   // Centered in both directions: MPEG-1 and JPEG
+    TopLeft = 2,  // Co-sited in both directions: BT.2020 and BT.2100 4:2:0
+};
+
+// Interlaced frames hold two fields on alternating lines, top field lines being the even ones
+enum class FieldOrder : uint32_t {
+    Progressive,
+    TopFieldFirst,
+    BottomFieldFirst,
+};
+
 enum class VideoFrameLayout {
     Planar,
     Biplanar,
     Interleaved,
 };
 
+// Rotation or mirroring applied to a source frame as it's converted, rotations are clockwise
+enum class VideoFrameOrientation : uint32_t {
+    Identity,
+    Rotate90,
+    Rotate180,
+    Rotate270,
+    FlipHorizontal,
+    FlipVertical,
+    Transpose,   // Mirrored along the top left to bottom right diagonal
+    Transverse,  // Mirrored along the top right to bottom left diagonal
+};
+
+// Rectangle in pixels, an empty rectangle stands for the whole frame
+struct VideoFrameRect {
+    float x = 0.0f;
+    float y = 0.0f;
+    float width = 0.0f;
+    float height = 0.0f;
+};
+
 struct PIXELWEAVE_LIB_CLASS VideoFrameWrapper {
     uint8_t* buffer = nullptr;
     size_t bufferSize = 0;             // Buffer size in bytes: set to zero to calculate based on stride and height
@@ -34,6 +83,19 @@ struct PIXELWEAVE_LIB_CLASS VideoFrameWrapper {
     PixelFormat pixelFormat = PixelFormat::RGB8BitInterleavedRGBA;
     bool isVideoFullRange = true;
     LumaChromaMatrix lumaChromaMatrix = LumaChromaMatrix::Identity;
+    TransferFunction transferFunction = TransferFunction::BT709;
+    ColorPrimaries colorPrimaries = ColorPrimaries::BT709;
+    ChromaSiting chromaSiting = ChromaSiting::Center;
+    FieldOrder fieldOrder = FieldOrder::Progressive;
+
+    // Source frames: area read and scaled into the destination, with sub-pixel precision for pan and zoom
+    VideoFrameRect cropRect;
+    // Source frames: transform applied to the crop, which then fills the destination placement in its new orientation
+    VideoFrameOrientation orientation = VideoFrameOrientation::Identity;
+    // Destination frames: area the source is scaled into, in whole pixels. Pixels outside of it are set to
+    // `fillColor`, given as full range RGB in [0, 1].
+    VideoFrameRect placementRect;
+    std::array<float, 3> fillColor = {0.0f, 0.0f, 0.0f};
 
     VideoFrameLayout GetLayoutType() const;
     uint64_t GetBufferSize() const;
@@ -45,10 +107,19 @@ struct PIXELWEAVE_LIB_CLASS VideoFrameWrapper {
     uint32_t GetChromaOffset() const;
     uint32_t GetCbOffset() const;
     uint32_t GetCrOffset() const;
+    uint32_t GetAlphaOffset() const;  // Offset of the alpha plane, 0 for formats without one
     uint32_t GetChromaStride() const;
     ColorFormat GetColorFormat() const;
     uint32_t GetChromaWidth() const;
     uint32_t GetChromaHeight() const;
+    bool IsChromaSubsampled() const;  // Whether chroma has fewer samples than luma
+
+    VideoFrameRect GetCropRect() const;       // `cropRect`, or the whole frame when empty
+    VideoFrameRect GetPlacementRect() const;  // `placementRect`, or the whole frame when empty
+    bool IsCropped() const;                   // Whether the crop rectangle leaves out part of the frame
+    bool IsPlaced() const;                    // Whether the placement rectangle leaves out part of the frame
+    bool IsTransposed() const;                // Whether the orientation swaps rows and columns
+    bool IsInterlaced() const;                // Whether lines alternate between two fields
 
     bool AreFramePropertiesEqual(const VideoFrameWrapper& other) const;
 };
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstdint>
+
+namespace Pixelweave
+{
+
+// 8-bit RGBA image with straight alpha, composited over destination frames. Samples are full range RGB, taken as
+// already encoded like the destination when blending in gamma space and as BT.709 SDR when blending in linear light.
+struct VideoOverlay {
+    const uint8_t* buffer = nullptr;  // Only read while the overlays are being set
+    uint32_t stride = 0;              // Row stride in bytes: set to zero for tightly packed rows
+    uint32_t width = 0;
+    uint32_t height = 0;
+    int32_t x = 0;  // Top left corner in destination pixels, overlays may extend past the frame edges
+    int32_t y = 0;
+    float alpha = 1.0f;  // Global opacity in [0, 1], multiplied with the alpha of every pixel
+};
+
+}  // namespace Pixelweave
@@ -0,0 +1,16 @@
+#pragma once
+
+#include "VideoFrameWrapper.h"
+
+namespace Pixelweave
+{
+
+// Source frame converted into a rectangle of a composed destination frame, with its own crop, orientation and scaling
+struct VideoTile {
+    VideoFrameWrapper frame;
+    // Destination area in whole pixels, used as the placement of the frame. Tiles can't overlap and must start and end
+    // on even pixels, and horizontally on multiples of 6 pixels for V210 and 8 pixels for 12-bit RGB destinations.
+    VideoFrameRect rect;
+};
+
+}  // namespace Pixelweave
@@ -0,0 +1,75 @@
+#include "ColorLUT.h"
+
+#include <fstream>
+#include <sstream>
+
+namespace Pixelweave
+{
+
+bool ColorLUT::IsEmpty() const
+{
+    return size == 0;
+}
+
+bool ColorLUT::IsValid() const
+{
+    if (IsEmpty()) {
+        return entries.empty();
+    }
+    return size >= 2 && entries.size() == static_cast<size_t>(size) * size * size * 3;
+}
+
+ResultValue<ColorLUT> ColorLUT::LoadCube(const std::string& path)
+{
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        return {Result::InvalidColorLUTError, {}};
+    }
+
+    ColorLUT lut;
+    std::string line;
+    while (std::getline(file, line)) {
+        std::istringstream lineStream(line);
+        std::string keyword;
+        if (!(lineStream >> keyword) || keyword[0] == '#' || keyword == "TITLE") {
+            continue;
+        }
+
+        if (keyword == "LUT_3D_SIZE") {
+            // The .cube specification caps tables at 256 points per axis
+            constexpr uint32_t maxSize = 256;
+            if (!(lineStream >> lut.size) || lut.size < 2 || lut.size > maxSize) {
+                return {Result::InvalidColorLUTError, {}};
+            }
+            lut.entries.reserve(static_cast<size_t>(lut.size) * lut.size * lut.size * 3);
+        } else if (keyword == "DOMAIN_MIN" || keyword == "DOMAIN_MAX") {
+            const float expectedValue = keyword == "DOMAIN_MIN" ? 0.0f : 1.0f;
+            float value;
+            for (uint32_t channel = 0; channel < 3; ++channel) {
+                if (!(lineStream >> value) || value != expectedValue) {
+                    return {Result::InvalidColorLUTError, {}};
+                }
+            }
+        } else if (keyword == "LUT_1D_SIZE" || keyword == "LUT_3D_INPUT_RANGE" || keyword == "LUT_1D_INPUT_RANGE") {
+            // 1D tables and shaper ranges aren't supported
+            return {Result::InvalidColorLUTError, {}};
+        } else {
+            // Anything else is a table entry, starting with its red value
+            std::istringstream entryStream(line);
+            float value;
+            for (uint32_t channel = 0; channel < 3; ++channel) {
+                if (!(entryStream >> value)) {
+                    return {Result::InvalidColorLUTError, {}};
+                }
+                lut.entries.push_back(value);
+            }
+        }
+    }
+
+    if (lut.IsEmpty() || !lut.IsValid()) {
+        return {Result::InvalidColorLUTError, {}};
+    }
+    return {Result::Success, lut};
+}
+
+}  // namespace Pixelweave
@@ -1,5 +1,8 @@
 #include "ColorSpaceUtils.h"
 
+#include <algorithm>
+#include <cmath>
+
 namespace Pixelweave
 {
 
@@ -30,6 +33,40 @@ glm::mat3 GetLumaChromaMatrix(LumaChromaMatrix matrix)
     }
 }
 
+namespace
+{
+
+glm::mat3 GetRGBToXYZMatrix(ColorPrimaries primaries)
+{
+    // CIE xy chromaticities of the red, green and blue primaries
+    glm::vec2 red, green, blue;
+    switch (primaries) {
+        default:
+        case ColorPrimaries::BT709:
+            red = {0.640f, 0.330f};
+            green = {0.300f, 0.600f};
+            blue = {0.150f, 0.060f};
+            break;
+        case ColorPrimaries::BT2020:
+            red = {0.708f, 0.292f};
+            green = {0.170f, 0.797f};
+            blue = {0.131f, 0.046f};
+            break;
+    }
+    const glm::vec2 whitePoint = {0.3127f, 0.3290f};  // D65
+
+    const auto xyToXYZ = [](const glm::vec2& xy) { return glm::vec3(xy.x / xy.y, 1.0f, (1.0f - xy.x - xy.y) / xy.y); };
+    const glm::mat3 primariesMatrix(xyToXYZ(red), xyToXYZ(green), xyToXYZ(blue));
+    // Scale each primary so that equal RGB values land on the white point
+    const glm::vec3 primariesScale = glm::inverse(primariesMatrix) * xyToXYZ(whitePoint);
+    return glm::mat3(
+        primariesMatrix[0] * primariesScale.x,
+        primariesMatrix[1] * primariesScale.y,
+        primariesMatrix[2] * primariesScale.z);
+}
+
+}  // namespace
+
 glm::vec3 GetLumaChromaScale(bool fullRange, uint32_t bitDepth)
 {
     if (fullRange) {
@@ -52,4 +89,77 @@ glm::vec3 GetLumaChromaOffset(bool fullRange, uint32_t bitDepth)
     return glm::vec3(blackLevel, achromaticLevel, achromaticLevel) / glm::vec3(maxValue);
 }
 
+glm::mat3 GetGamutConversionMatrix(ColorPrimaries srcPrimaries, ColorPrimaries dstPrimaries)
+{
+    if (srcPrimaries == dstPrimaries) {
+        return glm::mat3{1.0f};
+    }
+    return glm::inverse(GetRGBToXYZMatrix(dstPrimaries)) * GetRGBToXYZMatrix(srcPrimaries);
+}
+
+bool HaveSameColorEncoding(const VideoFrameWrapper& src, const VideoFrameWrapper& dst)
+{
+    return src.transferFunction == dst.transferFunction && src.colorPrimaries == dst.colorPrimaries;
+}
+
+bool LosesSamplePrecision(const VideoFrameWrapper& src, const VideoFrameWrapper& dst, bool altersColors)
+{
+    const bool isSrcRGB = src.GetColorFormat() == ColorFormat::RGB;
+    const bool isDstRGB = dst.GetColorFormat() == ColorFormat::RGB;
+    const bool hasColorMath = altersColors || isSrcRGB != isDstRGB || src.isVideoFullRange != dst.isVideoFullRange ||
+                              src.lumaChromaMatrix != dst.lumaChromaMatrix || !HaveSameColorEncoding(src, dst);
+    return dst.GetBitDepth() < src.GetBitDepth() || hasColorMath;
+}
+
+glm::uvec3 GetFillPixel(const VideoFrameWrapper& dst, bool isRGBRepack)
+{
+    const uint32_t bitDepth = dst.GetBitDepth();
+    glm::vec3 pixel(dst.fillColor[0], dst.fillColor[1], dst.fillColor[2]);
+    if (!isRGBRepack) {
+        const glm::vec3 yuv = GetLumaChromaMatrix(dst.lumaChromaMatrix) * pixel;
+        if (dst.GetColorFormat() == ColorFormat::RGB) {
+            // Turned back into RGB by `yuvToRGB`, which expects full range samples
+            pixel = yuv + GetLumaChromaOffset(true, bitDepth);
+        } else {
+            pixel = yuv * GetLumaChromaScale(dst.isVideoFullRange, bitDepth) +
+                    GetLumaChromaOffset(dst.isVideoFullRange, bitDepth);
+        }
+    }
+    const float maxValue = static_cast<float>((1 << bitDepth) - 1);
+    return glm::uvec3(glm::clamp(glm::round(pixel * maxValue), glm::vec3(0.0f), glm::vec3(maxValue)));
+}
+
+bool IsPerChannelConversion(const VideoFrameWrapper& src, const VideoFrameWrapper& dst)
+{
+    const bool isYUVToYUV = src.GetColorFormat() != ColorFormat::RGB && dst.GetColorFormat() != ColorFormat::RGB;
+    const bool changesSamples = src.isVideoFullRange != dst.isVideoFullRange || src.GetBitDepth() != dst.GetBitDepth();
+    return isYUVToYUV && changesSamples && src.lumaChromaMatrix == dst.lumaChromaMatrix &&
+           HaveSameColorEncoding(src, dst) && src.GetBitDepth() <= MaxSampleLUTBitDepth;
+}
+
+std::vector<uint32_t> GetPerChannelConversionLUT(const VideoFrameWrapper& src, const VideoFrameWrapper& dst)
+{
+    // Mirrors `srcPixelToDstPixel` in the conversion shader, where matching matrices cancel out
+    const uint32_t tableSize = 1 << src.GetBitDepth();
+    const float maxValueSrc = static_cast<float>(tableSize - 1);
+    const float maxValueDst = static_cast<float>((1 << dst.GetBitDepth()) - 1);
+    const glm::vec3 srcScale = GetLumaChromaScale(src.isVideoFullRange, src.GetBitDepth());
+    const glm::vec3 srcOffset = GetLumaChromaOffset(src.isVideoFullRange, src.GetBitDepth());
+    const glm::vec3 dstScale = GetLumaChromaScale(dst.isVideoFullRange, dst.GetBitDepth());
+    const glm::vec3 dstOffset = GetLumaChromaOffset(dst.isVideoFullRange, dst.GetBitDepth());
+
+    std::vector<uint32_t> table(tableSize * 3);
+    for (uint32_t channel = 0; channel < 3; ++channel) {
+        for (uint32_t sample = 0; sample < tableSize; ++sample) {
+            float value = static_cast<float>(sample) / maxValueSrc;
+            if (src.isVideoFullRange != dst.isVideoFullRange) {
+                value = (value - srcOffset[channel]) / srcScale[channel] * dstScale[channel] + dstOffset[channel];
+            }
+            const float scaledValue = std::clamp(std::round(value * maxValueDst), 0.0f, maxValueDst);
+            table[channel * tableSize + sample] = static_cast<uint32_t>(scaledValue);
+        }
+    }
+    return table;
+}
+
 }  // namespace Pixelweave
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <vector>
+
 #include "glm/glm.hpp"
 
 #include "VideoFrameWrapper.h"
@@ -11,4 +13,26 @@ glm::mat3 GetLumaChromaMatrix(LumaChromaMatrix matrix);
 glm::vec3 GetLumaChromaScale(bool fullRange, uint32_t bitDepth);
 glm::vec3 GetLumaChromaOffset(bool fullRange, uint32_t bitDepth);
 
+// Maps linear RGB with `srcPrimaries` to linear RGB with `dstPrimaries`, through CIE XYZ
+glm::mat3 GetGamutConversionMatrix(ColorPrimaries srcPrimaries, ColorPrimaries dstPrimaries);
+
+// Whether both frames share transfer function and primaries, so converting them needs no linearization
+bool HaveSameColorEncoding(const VideoFrameWrapper& src, const VideoFrameWrapper& dst);
+
+// Whether destination samples lose precision converting `src` into `dst`, either by dropping bits or through color
+// math leaving fractional values, which is when dithering pays off. `altersColors` covers color LUTs and tone mapping.
+bool LosesSamplePrecision(const VideoFrameWrapper& src, const VideoFrameWrapper& dst, bool altersColors);
+
+// Destination samples of `dst.fillColor`, matching what `srcPixelToDstPixel` in the conversion shader produces: RGB
+// samples when repacking between RGB formats, YUV samples otherwise
+glm::uvec3 GetFillPixel(const VideoFrameWrapper& dst, bool isRGBRepack);
+
+// Sources up to this bit depth use lookup tables for per channel conversions, keeping tables at 1024 entries or less
+constexpr uint32_t MaxSampleLUTBitDepth = 10;
+
+// Whether converting `src` into `dst` maps each YUV channel independently, when only range or bit depth change
+bool IsPerChannelConversion(const VideoFrameWrapper& src, const VideoFrameWrapper& dst);
+// Destination sample values for Y, Cb and Cr, stored one table after the other and indexed by source sample value
+std::vector<uint32_t> GetPerChannelConversionLUT(const VideoFrameWrapper& src, const VideoFrameWrapper& dst);
+
 }  // namespace Pixelweave
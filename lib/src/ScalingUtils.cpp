@@ -0,0 +1,211 @@
+#include "ScalingUtils.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace Pixelweave
+{
+
+namespace
+{
+
+float GetFilterRadius(ScalingFilter filter)
+{
+    switch (filter) {
+        default:
+        case ScalingFilter::Bilinear:
+            return 1.0f;
+        case ScalingFilter::Bicubic:
+            return 2.0f;
+        case ScalingFilter::Lanczos3:
+            return 3.0f;
+    }
+}
+
+float EvaluateFilter(ScalingFilter filter, float distance)
+{
+    distance = std::abs(distance);
+    switch (filter) {
+        default:
+        case ScalingFilter::Bilinear:
+            return std::max(1.0f - distance, 0.0f);
+        case ScalingFilter::Bicubic: {
+            // Keys cubic convolution with a = -0.5 (Catmull-Rom)
+            constexpr float a = -0.5f;
+            if (distance < 1.0f) {
+                return ((a + 2.0f) * distance - (a + 3.0f)) * distance * distance + 1.0f;
+            }
+            if (distance < 2.0f) {
+                return ((a * distance - 5.0f * a) * distance + 8.0f * a) * distance - 4.0f * a;
+            }
+            return 0.0f;
+        }
+        case ScalingFilter::Lanczos3: {
+            constexpr float pi = 3.14159265358979f;
+            constexpr float radius = 3.0f;
+            if (distance < 1e-6f) {
+                return 1.0f;
+            }
+            if (distance >= radius) {
+                return 0.0f;
+            }
+            const float piDistance = pi * distance;
+            return radius * std::sin(piDistance) * std::sin(piDistance / radius) / (piDistance * piDistance);
+        }
+    }
+}
+
+// Downscaling stretches the filter over the source footprint of a destination sample to avoid aliasing
+float GetFilterScale(float srcSize, uint32_t dstSize)
+{
+    return std::max(srcSize / static_cast<float>(dstSize), 1.0f);
+}
+
+bool IsWholePixelRect(const VideoFrameRect& rect)
+{
+    return std::floor(rect.x) == rect.x && std::floor(rect.y) == rect.y && std::floor(rect.width) == rect.width &&
+           std::floor(rect.height) == rect.height;
+}
+
+// Box filter spanning the destination pixel, weighting each source pixel by the fraction of it that is covered
+ScalingWeights GetAreaScalingWeights(float srcOffset, float srcSize, uint32_t dstSize, uint32_t tapCount)
+{
+    const double scale = static_cast<double>(srcSize) / static_cast<double>(dstSize);
+
+    ScalingWeights result;
+    result.tapCount = tapCount;
+    result.firstIndices.resize(dstSize);
+    result.weights.resize(static_cast<size_t>(dstSize) * tapCount);
+
+    for (uint32_t dstIndex = 0; dstIndex < dstSize; ++dstIndex) {
+        const double footprintStart = srcOffset + dstIndex * scale;
+        const double footprintEnd = srcOffset + (dstIndex + 1) * scale;
+        const int32_t firstIndex = static_cast<int32_t>(std::floor(footprintStart));
+        result.firstIndices[dstIndex] = firstIndex;
+
+        float* weights = &result.weights[static_cast<size_t>(dstIndex) * tapCount];
+        for (uint32_t tap = 0; tap < tapCount; ++tap) {
+            const double srcStart = static_cast<double>(firstIndex + static_cast<int32_t>(tap));
+            const double coverage = std::min(srcStart + 1.0, footprintEnd) - std::max(srcStart, footprintStart);
+            weights[tap] = static_cast<float>(std::max(coverage, 0.0) / scale);
+        }
+    }
+    return result;
+}
+
+}  // namespace
+
+ScaledSize GetScaledSize(const VideoFrameWrapper& src, const VideoFrameWrapper& dst)
+{
+    const VideoFrameRect placementRect = dst.GetPlacementRect();
+    const uint32_t placementWidth = static_cast<uint32_t>(placementRect.width);
+    const uint32_t placementHeight = static_cast<uint32_t>(placementRect.height);
+    if (src.IsTransposed()) {
+        return ScaledSize{placementHeight, placementWidth};
+    }
+    return ScaledSize{placementWidth, placementHeight};
+}
+
+bool IsScaling(const VideoFrameWrapper& src, const VideoFrameWrapper& dst)
+{
+    const VideoFrameRect cropRect = src.GetCropRect();
+    const ScaledSize scaledSize = GetScaledSize(src, dst);
+    // Sub-pixel crop offsets need filtering even without a size change
+    return cropRect.width != static_cast<float>(scaledSize.width) ||
+           cropRect.height != static_cast<float>(scaledSize.height) || !IsWholePixelRect(cropRect);
+}
+
+uint32_t GetScalingTapCount(ScalingFilter filter, float srcSize, uint32_t dstSize)
+{
+    if (filter == ScalingFilter::Area) {
+        // An unaligned footprint touches one partially covered pixel more than its length
+        return static_cast<uint32_t>(std::ceil(static_cast<double>(srcSize) / static_cast<double>(dstSize))) + 1;
+    }
+    const float support = GetFilterRadius(filter) * GetFilterScale(srcSize, dstSize);
+    return static_cast<uint32_t>(std::ceil(support)) * 2 + 1;
+}
+
+ScalingWeights GetScalingWeights(ScalingFilter filter, float srcOffset, float srcSize, uint32_t dstSize)
+{
+    if (filter == ScalingFilter::Area) {
+        return GetAreaScalingWeights(srcOffset, srcSize, dstSize, GetScalingTapCount(filter, srcSize, dstSize));
+    }
+
+    const float scale = srcSize / static_cast<float>(dstSize);
+    const float filterScale = GetFilterScale(srcSize, dstSize);
+    const float support = GetFilterRadius(filter) * filterScale;
+
+    ScalingWeights result;
+    result.tapCount = GetScalingTapCount(filter, srcSize, dstSize);
+    result.firstIndices.resize(dstSize);
+    result.weights.resize(static_cast<size_t>(dstSize) * result.tapCount);
+
+    for (uint32_t dstIndex = 0; dstIndex < dstSize; ++dstIndex) {
+        // Sample centers are aligned, so destination sample `i` maps to `(i + 0.5) * scale` in the source
+        const float center = srcOffset + (static_cast<float>(dstIndex) + 0.5f) * scale;
+        const int32_t firstIndex = static_cast<int32_t>(std::floor(center - support));
+        result.firstIndices[dstIndex] = firstIndex;
+
+        float* weights = &result.weights[static_cast<size_t>(dstIndex) * result.tapCount];
+        float weightSum = 0.0f;
+        for (uint32_t tap = 0; tap < result.tapCount; ++tap) {
+            const float srcCenter = static_cast<float>(firstIndex + static_cast<int32_t>(tap)) + 0.5f;
+            weights[tap] = EvaluateFilter(filter, (srcCenter - center) / filterScale);
+            weightSum += weights[tap];
+        }
+        if (weightSum != 0.0f) {
+            for (uint32_t tap = 0; tap < result.tapCount; ++tap) {
+                weights[tap] /= weightSum;
+            }
+        }
+    }
+    return result;
+}
+
+uint32_t GetIntegerScalingRatio(uint32_t srcSize, uint32_t dstSize)
+{
+    if (srcSize % dstSize != 0 || srcSize / dstSize > MaxIntegerAreaScalingRatio) {
+        return 0;
+    }
+    return srcSize / dstSize;
+}
+
+bool IsIntegerAreaScaling(ScalingFilter filter, const VideoFrameWrapper& src, const VideoFrameWrapper& dst)
+{
+    const VideoFrameRect cropRect = src.GetCropRect();
+    const ScaledSize scaledSize = GetScaledSize(src, dst);
+    if (filter != ScalingFilter::Area || !IsWholePixelRect(cropRect)) {
+        return false;
+    }
+    const uint32_t ratioX = GetIntegerScalingRatio(static_cast<uint32_t>(cropRect.width), scaledSize.width);
+    const uint32_t ratioY = GetIntegerScalingRatio(static_cast<uint32_t>(cropRect.height), scaledSize.height);
+    return ratioX != 0 && ratioY != 0;
+}
+
+std::vector<uint32_t> GetSeparableScalerTable(
+    ScalingFilter filter,
+    const VideoFrameWrapper& src,
+    const VideoFrameWrapper& dst)
+{
+    const VideoFrameRect cropRect = src.GetCropRect();
+    const ScaledSize scaledSize = GetScaledSize(src, dst);
+    std::vector<uint32_t> table;
+    for (const ScalingWeights& scalingWeights :
+         {GetScalingWeights(filter, cropRect.x, cropRect.width, scaledSize.width),
+          GetScalingWeights(filter, cropRect.y, cropRect.height, scaledSize.height)}) {
+        const size_t dstSize = scalingWeights.firstIndices.size();
+        for (size_t dstIndex = 0; dstIndex < dstSize; ++dstIndex) {
+            uint32_t word;
+            std::memcpy(&word, &scalingWeights.firstIndices[dstIndex], sizeof(word));
+            table.push_back(word);
+            for (uint32_t tap = 0; tap < scalingWeights.tapCount; ++tap) {
+                std::memcpy(&word, &scalingWeights.weights[dstIndex * scalingWeights.tapCount + tap], sizeof(word));
+                table.push_back(word);
+            }
+        }
+    }
+    return table;
+}
+
+}  // namespace Pixelweave
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "VideoConverterConfig.h"
+#include "VideoFrameWrapper.h"
+
+namespace Pixelweave
+{
+
+// Polyphase weights for one separable scaling pass. Destination sample `i` is the sum of `tapCount` source samples
+// starting at `firstIndices[i]`, weighted by `weights[i * tapCount + tap]`. Indices may fall outside the source and
+// are expected to be clamped to its edges.
+struct ScalingWeights {
+    uint32_t tapCount = 0;
+    std::vector<int32_t> firstIndices;
+    std::vector<float> weights;
+};
+
+// Integer reductions up to this ratio are handled by the area filter in a single pass
+constexpr uint32_t MaxIntegerAreaScalingRatio = 4;
+
+// Size of the destination placement in the orientation of the source: the crop rectangle of `src` is scaled to this
+// size, then rotated or mirrored into the placement
+struct ScaledSize {
+    uint32_t width = 0;
+    uint32_t height = 0;
+};
+
+ScaledSize GetScaledSize(const VideoFrameWrapper& src, const VideoFrameWrapper& dst);
+
+// Whether the crop rectangle of `src` is resampled to the scaled size, rather than read pixel for pixel
+bool IsScaling(const VideoFrameWrapper& src, const VideoFrameWrapper& dst);
+
+uint32_t GetScalingTapCount(ScalingFilter filter, float srcSize, uint32_t dstSize);
+// Weights resampling `srcSize` source samples starting at `srcOffset` into `dstSize` destination samples
+ScalingWeights GetScalingWeights(ScalingFilter filter, float srcOffset, float srcSize, uint32_t dstSize);
+
+// Reduction ratio when `srcSize` is an integer multiple of `dstSize` up to `MaxIntegerAreaScalingRatio`, 0 otherwise
+uint32_t GetIntegerScalingRatio(uint32_t srcSize, uint32_t dstSize);
+
+// Whether the area filter can average whole source blocks, reading each source pixel once, instead of running the
+// separable scaler. Crop rectangles must be aligned to whole pixels.
+bool IsIntegerAreaScaling(ScalingFilter filter, const VideoFrameWrapper& src, const VideoFrameWrapper& dst);
+
+// Horizontal weights followed by vertical weights as 32-bit words, laid out as read by the separable scaler passes of
+// the conversion shader: each sample of the scaled size stores its first source index followed by its tap weights.
+std::vector<uint32_t> GetSeparableScalerTable(
+    ScalingFilter filter,
+    const VideoFrameWrapper& src,
+    const VideoFrameWrapper& dst);
+
+}  // namespace Pixelweave
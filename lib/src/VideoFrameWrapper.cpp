@@ -7,7 +7,7 @@ namespace Pixelweave
 
 VideoFrameLayout VideoFrameWrapper::GetLayoutType() const
 {
-    static_assert(AllPixelFormats.size() == 25);
+    static_assert(AllPixelFormats.size() == 37);
     switch (pixelFormat) {
         default:
         case PixelFormat::RGB8BitInterleavedRGBA:
@@ -23,6 +23,12 @@ VideoFrameLayout VideoFrameWrapper::GetLayoutType() const
         case PixelFormat::RGB12BitInterleavedBGRLE:
         case PixelFormat::YCC8Bit422InterleavedUYVY:
         case PixelFormat::YCC10Bit422InterleavedV210:
+        case PixelFormat::YCC8Bit422InterleavedYUY2:
+        case PixelFormat::YCC10Bit422InterleavedY210:
+        case PixelFormat::YCC10Bit444InterleavedV410:
+        case PixelFormat::RGB8BitInterleavedRGB:
+        case PixelFormat::RGB8BitInterleavedBGR:
+        case PixelFormat::RGB16BitInterleavedRGB:
             return VideoFrameLayout::Interleaved;
         case PixelFormat::YCC8Bit420Planar:
         case PixelFormat::YCC8Bit420PlanarYV12:
@@ -31,6 +37,12 @@ VideoFrameLayout VideoFrameWrapper::GetLayoutType() const
         case PixelFormat::YCC10Bit420Planar:
         case PixelFormat::YCC10Bit422Planar:
         case PixelFormat::YCC10Bit444Planar:
+        case PixelFormat::YCCA8Bit420Planar:
+        case PixelFormat::YCCA8Bit444Planar:
+        case PixelFormat::RGB8BitPlanarGBR:
+        case PixelFormat::RGB16BitPlanarGBR:
+        case PixelFormat::RGBFloat16PlanarNCHW:
+        case PixelFormat::RGBFloat32PlanarNCHW:
             return VideoFrameLayout::Planar;
         case PixelFormat::YCC8Bit420BiplanarNV12:
         case PixelFormat::YCC10Bit420BiplanarP010:
@@ -54,7 +66,8 @@ uint64_t VideoFrameWrapper::GetBufferSize() const
         case VideoFrameLayout::Biplanar: {
             const uint64_t lumaSize = static_cast<uint64_t>(stride) * height;
             const uint64_t chromaSize = GetChromaStride() * GetChromaHeight();
-            return lumaSize + chromaSize * 2;
+            const uint64_t alphaSize = GetAlphaOffset() != 0 ? lumaSize : 0;
+            return lumaSize + chromaSize * 2 + alphaSize;
         }
         default:
             return 0;
@@ -74,6 +87,8 @@ size_t VideoFrameWrapper::GetPlaneOffset(size_t index) const
             return height * stride;
         case 2:
             return GetPlaneOffset(1) + GetChromaHeight() * GetChromaStride();
+        case 3:
+            return GetPlaneOffset(2) + GetChromaHeight() * GetChromaStride();
         default:
             return 0;
     }
@@ -81,7 +96,7 @@ size_t VideoFrameWrapper::GetPlaneOffset(size_t index) const
 
 ColorFormat VideoFrameWrapper::GetColorFormat() const
 {
-    static_assert(AllPixelFormats.size() == 25);
+    static_assert(AllPixelFormats.size() == 37);
     switch (pixelFormat) {
         default:
         case PixelFormat::RGB8BitInterleavedBGRA:
@@ -95,12 +110,20 @@ ColorFormat VideoFrameWrapper::GetColorFormat() const
         case PixelFormat::RGB10BitInterleavedXBGRLE:
         case PixelFormat::RGB12BitInterleavedBGRBE:
         case PixelFormat::RGB12BitInterleavedBGRLE:
+        case PixelFormat::RGB8BitInterleavedRGB:
+        case PixelFormat::RGB8BitInterleavedBGR:
+        case PixelFormat::RGB16BitInterleavedRGB:
+        case PixelFormat::RGB8BitPlanarGBR:
+        case PixelFormat::RGB16BitPlanarGBR:
+        case PixelFormat::RGBFloat16PlanarNCHW:
+        case PixelFormat::RGBFloat32PlanarNCHW:
             return ColorFormat::RGB;
         case PixelFormat::YCC8Bit420Planar:
         case PixelFormat::YCC8Bit420PlanarYV12:
         case PixelFormat::YCC8Bit420BiplanarNV12:
         case PixelFormat::YCC10Bit420Planar:
         case PixelFormat::YCC10Bit420BiplanarP010:
+        case PixelFormat::YCCA8Bit420Planar:
             return ColorFormat::YUV420;
         case PixelFormat::YCC8Bit422Planar:
         case PixelFormat::YCC8Bit422InterleavedUYVY:
@@ -108,10 +131,14 @@ ColorFormat VideoFrameWrapper::GetColorFormat() const
         case PixelFormat::YCC10Bit422InterleavedV210:
         case PixelFormat::YCC10Bit422BiplanarP210:
         case PixelFormat::YCC16Bit422BiplanarP216:
+        case PixelFormat::YCC8Bit422InterleavedYUY2:
+        case PixelFormat::YCC10Bit422InterleavedY210:
             return ColorFormat::YUV422;
         case PixelFormat::YCC8Bit444Planar:
         case PixelFormat::YCC10Bit444Planar:
         case PixelFormat::YCC10Bit444BiplanarP410:
+        case PixelFormat::YCC10Bit444InterleavedV410:
+        case PixelFormat::YCCA8Bit444Planar:
             return ColorFormat::YUV444;
     }
 }
@@ -125,7 +152,8 @@ uint32_t VideoFrameWrapper::GetChromaWidth() const
         case ColorFormat::YUV420:
             return (width + 1) / 2;
         default:
-            return 0;
+            // Planar RGB keeps every plane at full resolution
+            return GetLayoutType() == VideoFrameLayout::Planar ? width : 0;
     }
 }
 
@@ -138,12 +166,15 @@ uint32_t VideoFrameWrapper::GetChromaHeight() const
         case ColorFormat::YUV420:
             return (height + 1) / 2;
         default:
-            return 0;
+            return GetLayoutType() == VideoFrameLayout::Planar ? height : 0;
     }
 }
 
 uint32_t VideoFrameWrapper::GetChromaStride() const
 {
+    if (GetColorFormat() == ColorFormat::RGB) {
+        return stride;
+    }
     return chromaStride;
 }
 
@@ -161,7 +192,7 @@ uint32_t VideoFrameWrapper::GetChromaOffset() const
 
 uint32_t VideoFrameWrapper::GetCbOffset() const
 {
-    static_assert(AllPixelFormats.size() == 25);
+    static_assert(AllPixelFormats.size() == 37);
     switch (pixelFormat) {
         case PixelFormat::YCC8Bit420Planar:
         case PixelFormat::YCC8Bit422Planar:
@@ -174,6 +205,8 @@ uint32_t VideoFrameWrapper::GetCbOffset() const
         case PixelFormat::YCC10Bit420BiplanarP010:
         case PixelFormat::YCC10Bit444BiplanarP410:
         case PixelFormat::YCC16Bit422BiplanarP216:
+        case PixelFormat::YCCA8Bit420Planar:
+        case PixelFormat::YCCA8Bit444Planar:
             return static_cast<uint32_t>(GetPlaneOffset(1));
         case PixelFormat::YCC8Bit420PlanarYV12:
             return static_cast<uint32_t>(GetPlaneOffset(2));
@@ -184,7 +217,7 @@ uint32_t VideoFrameWrapper::GetCbOffset() const
 
 uint32_t VideoFrameWrapper::GetCrOffset() const
 {
-    static_assert(AllPixelFormats.size() == 25);
+    static_assert(AllPixelFormats.size() == 37);
     switch (pixelFormat) {
         case PixelFormat::YCC8Bit420Planar:
         case PixelFormat::YCC8Bit422Planar:
@@ -192,6 +225,8 @@ uint32_t VideoFrameWrapper::GetCrOffset() const
         case PixelFormat::YCC10Bit420Planar:
         case PixelFormat::YCC10Bit422Planar:
         case PixelFormat::YCC10Bit444Planar:
+        case PixelFormat::YCCA8Bit420Planar:
+        case PixelFormat::YCCA8Bit444Planar:
             return static_cast<uint32_t>(GetPlaneOffset(2));
         case PixelFormat::YCC8Bit420PlanarYV12:
         case PixelFormat::YCC8Bit420BiplanarNV12:
@@ -205,9 +240,21 @@ uint32_t VideoFrameWrapper::GetCrOffset() const
     }
 }
 
+uint32_t VideoFrameWrapper::GetAlphaOffset() const
+{
+    static_assert(AllPixelFormats.size() == 37);
+    switch (pixelFormat) {
+        case PixelFormat::YCCA8Bit420Planar:
+        case PixelFormat::YCCA8Bit444Planar:
+            return static_cast<uint32_t>(GetPlaneOffset(3));
+        default:
+            return 0;
+    }
+}
+
 uint32_t VideoFrameWrapper::GetBitDepth() const
 {
-    static_assert(AllPixelFormats.size() == 25);
+    static_assert(AllPixelFormats.size() == 37);
     switch (pixelFormat) {
         case PixelFormat::RGB8BitInterleavedBGRA:
         case PixelFormat::RGB8BitInterleavedRGBA:
@@ -218,6 +265,12 @@ uint32_t VideoFrameWrapper::GetBitDepth() const
         case PixelFormat::YCC8Bit444Planar:
         case PixelFormat::YCC8Bit420BiplanarNV12:
         case PixelFormat::YCC8Bit422InterleavedUYVY:
+        case PixelFormat::YCC8Bit422InterleavedYUY2:
+        case PixelFormat::RGB8BitInterleavedRGB:
+        case PixelFormat::RGB8BitInterleavedBGR:
+        case PixelFormat::YCCA8Bit420Planar:
+        case PixelFormat::YCCA8Bit444Planar:
+        case PixelFormat::RGB8BitPlanarGBR:
             return 8;
         case PixelFormat::RGB10BitInterleavedXRGBBE:
         case PixelFormat::RGB10BitInterleavedXRGBLE:
@@ -232,11 +285,18 @@ uint32_t VideoFrameWrapper::GetBitDepth() const
         case PixelFormat::YCC10Bit422BiplanarP210:
         case PixelFormat::YCC10Bit444BiplanarP410:
         case PixelFormat::YCC10Bit422InterleavedV210:
+        case PixelFormat::YCC10Bit422InterleavedY210:
+        case PixelFormat::YCC10Bit444InterleavedV410:
             return 10;
         case PixelFormat::RGB12BitInterleavedBGRBE:
         case PixelFormat::RGB12BitInterleavedBGRLE:
             return 12;
         case PixelFormat::YCC16Bit422BiplanarP216:
+        case PixelFormat::RGB16BitInterleavedRGB:
+        case PixelFormat::RGB16BitPlanarGBR:
+        // Float tensors are normalized from 16-bit RGB samples
+        case PixelFormat::RGBFloat16PlanarNCHW:
+        case PixelFormat::RGBFloat32PlanarNCHW:
             return 16;
         default:
             return 0;
@@ -245,17 +305,84 @@ uint32_t VideoFrameWrapper::GetBitDepth() const
 
 uint32_t VideoFrameWrapper::GetByteDepth() const
 {
+    if (pixelFormat == PixelFormat::RGBFloat32PlanarNCHW) {
+        return 4;
+    }
     const uint32_t bitDepth = GetBitDepth();
     const uint32_t fullBytes = bitDepth / 8;
     const uint32_t remainingBits = bitDepth % 8;
     return fullBytes + (remainingBits > 0 ? 1 : 0);
 }
 
+namespace
+{
+
+VideoFrameRect GetRectOrFrame(const VideoFrameRect& rect, uint32_t width, uint32_t height)
+{
+    if (rect.width <= 0.0f || rect.height <= 0.0f) {
+        return VideoFrameRect{0.0f, 0.0f, static_cast<float>(width), static_cast<float>(height)};
+    }
+    return rect;
+}
+
+bool IsWholeFrame(const VideoFrameRect& rect, uint32_t width, uint32_t height)
+{
+    return rect.x == 0.0f && rect.y == 0.0f && rect.width == static_cast<float>(width) &&
+           rect.height == static_cast<float>(height);
+}
+
+bool AreRectsEqual(const VideoFrameRect& rect, const VideoFrameRect& other)
+{
+    return rect.x == other.x && rect.y == other.y && rect.width == other.width && rect.height == other.height;
+}
+
+}  // namespace
+
+VideoFrameRect VideoFrameWrapper::GetCropRect() const
+{
+    return GetRectOrFrame(cropRect, width, height);
+}
+
+VideoFrameRect VideoFrameWrapper::GetPlacementRect() const
+{
+    return GetRectOrFrame(placementRect, width, height);
+}
+
+bool VideoFrameWrapper::IsCropped() const
+{
+    return !IsWholeFrame(GetCropRect(), width, height);
+}
+
+bool VideoFrameWrapper::IsPlaced() const
+{
+    return !IsWholeFrame(GetPlacementRect(), width, height);
+}
+
+bool VideoFrameWrapper::IsChromaSubsampled() const
+{
+    const ColorFormat colorFormat = GetColorFormat();
+    return colorFormat == ColorFormat::YUV420 || colorFormat == ColorFormat::YUV422;
+}
+
+bool VideoFrameWrapper::IsTransposed() const
+{
+    return orientation == VideoFrameOrientation::Rotate90 || orientation == VideoFrameOrientation::Rotate270 ||
+           orientation == VideoFrameOrientation::Transpose || orientation == VideoFrameOrientation::Transverse;
+}
+
+bool VideoFrameWrapper::IsInterlaced() const
+{
+    return fieldOrder != FieldOrder::Progressive;
+}
+
 bool VideoFrameWrapper::AreFramePropertiesEqual(const VideoFrameWrapper& other) const
 {
     return stride == other.stride && width == other.width && height == other.height &&
            pixelFormat == other.pixelFormat && isVideoFullRange == other.isVideoFullRange &&
-           lumaChromaMatrix == other.lumaChromaMatrix;
+           lumaChromaMatrix == other.lumaChromaMatrix && transferFunction == other.transferFunction &&
+           colorPrimaries == other.colorPrimaries && AreRectsEqual(GetCropRect(), other.GetCropRect()) &&
+           AreRectsEqual(GetPlacementRect(), other.GetPlacementRect()) && fillColor == other.fillColor &&
+           orientation == other.orientation && chromaSiting == other.chromaSiting && fieldOrder == other.fieldOrder;
 }
 
 }  // namespace Pixelweave
@@ -1,6 +1,7 @@
 #include "VulkanDevice.h"
 
 #include <array>
+#include <cmath>
 #include <limits>
 
 #define VMA_IMPLEMENTATION
@@ -12,6 +13,7 @@
 #include "ColorSpaceUtils.h"
 #include "DebugUtils.h"
 #include "ResourceLoader.h"
+#include "ScalingUtils.h"
 #include "VideoFrameWrapper.h"
 #include "VulkanInstance.h"
 #include "VulkanVideoConverter.h"
@@ -30,7 +32,7 @@ ResultValue<Device*> VulkanDevice::Create()
 }
 
 VulkanDevice::VulkanDevice(const std::shared_ptr<VulkanInstance>& instance, vk::PhysicalDevice physicalDevice)
-    : mVulkanInstance(instance), mPhysicalDevice(physicalDevice)
+    : mVulkanInstance(instance), mPhysicalDevice(physicalDevice), mSupportsFloat16Arithmetic(false)
 {
     const std::vector<vk::QueueFamilyProperties> queueFamiliesProperties = mPhysicalDevice.getQueueFamilyProperties();
     uint32_t queueFamilyIndex = 0;
@@ -51,7 +53,9 @@ VulkanDevice::VulkanDevice(const std::shared_ptr<VulkanInstance>& instance, vk::
     vk::PhysicalDeviceFeatures2 physicalDeviceFeatures =
         vk::PhysicalDeviceFeatures2().setPNext(&physicalDeviceFeatures1_1);
     physicalDevice.getFeatures2(&physicalDeviceFeatures);
+    mSupportsFloat16Arithmetic = physicalDeviceFeatures1_2.shaderFloat16 == VK_TRUE;
 
+    // All supported features are enabled, including `shaderFloat16` for the half precision shader variant
     const vk::DeviceCreateInfo deviceCreateInfo =
         vk::DeviceCreateInfo().setQueueCreateInfos(queueCreateInfo).setPNext(&physicalDeviceFeatures);
     mLogicalDevice = PIXELWEAVE_ASSERT_VK(mPhysicalDevice.createDevice(deviceCreateInfo));
@@ -79,7 +83,12 @@ VulkanDevice::VulkanDevice(const std::shared_ptr<VulkanInstance>& instance, vk::
 
 VideoConverter* VulkanDevice::CreateVideoConverter()
 {
-    return new VulkanVideoConverter(this);
+    return CreateVideoConverter(VideoConverterConfig{});
+}
+
+VideoConverter* VulkanDevice::CreateVideoConverter(const VideoConverterConfig& config)
+{
+    return new VulkanVideoConverter(this, config);
 }
 
 ResultValue<VulkanBuffer*> VulkanDevice::CreateBuffer(
@@ -90,7 +99,64 @@ ResultValue<VulkanBuffer*> VulkanDevice::CreateBuffer(
     return VulkanBuffer::Create(this, size, usageFlags, memoryFlags);
 }
 
-std::vector<uint32_t> CompileShader(const VideoFrameWrapper& src, const VideoFrameWrapper& dst)
+ResultValue<VulkanImage*> VulkanDevice::CreateImage(
+    const vk::Extent2D& extent,
+    const vk::Format& format,
+    const vk::ImageUsageFlags& usageFlags)
+{
+    return VulkanImage::Create(this, extent, format, usageFlags);
+}
+
+uint32_t GetPackedGroupPixelCount(PixelFormat pixelFormat)
+{
+    switch (pixelFormat) {
+        case PixelFormat::YCC10Bit422InterleavedV210:
+            return 6;
+        case PixelFormat::RGB12BitInterleavedBGRBE:
+        case PixelFormat::RGB12BitInterleavedBGRLE:
+            return 8;
+        default:
+            return 0;
+    }
+}
+
+// The values here must match the `ScalerPass` defines in `convert.comp`
+enum class ScalerPass : uint32_t {
+    None,
+    Horizontal,
+    Vertical,
+};
+
+// Compile time options selecting the code paths of the conversion shader
+struct ShaderVariant {
+    bool useFloat16Arithmetic = false;
+    bool useSubgroupQuads = false;
+    bool useSampledImages = false;
+    bool useSampleLUT = false;
+    uint32_t colorLUTSize = 0;
+    ScalerPass scalerPass = ScalerPass::None;
+    uint32_t scalerTapCountX = 0;
+    uint32_t scalerTapCountY = 0;
+    uint32_t scalerBoxRatioX = 0;
+    uint32_t scalerBoxRatioY = 0;
+    glm::vec3 tensorScale = glm::vec3(1.0f);
+    glm::vec3 tensorBias = glm::vec3(0.0f);
+    ToneMapping toneMapping = ToneMapping::None;
+    float toneMappingSourcePeak = 0.0f;
+    float toneMappingTargetPeak = 0.0f;
+    Dithering dithering = Dithering::None;
+    Deinterlacing deinterlacing = Deinterlacing::Weave;
+    bool useOverlays = false;
+    OverlayBlending overlayBlending = OverlayBlending::Gamma;
+    bool writesPlacementOnly = false;
+    bool collectStatistics = false;
+    bool detectChanges = false;
+};
+
+std::vector<uint32_t> CompileShader(
+    const VideoFrameWrapper& src,
+    const VideoFrameWrapper& dst,
+    const ShaderVariant& variant)
 {
     Resource shaderResource = ResourceLoader::Load(Resource::Id::ComputeShader);
 
@@ -98,6 +164,7 @@ std::vector<uint32_t> CompileShader(const VideoFrameWrapper& src, const VideoFra
     shaderc::CompileOptions options;
 
     options.SetOptimizationLevel(shaderc_optimization_level::shaderc_optimization_level_performance);
+    options.SetTargetEnvironment(shaderc_target_env_vulkan, shaderc_env_version_vulkan_1_2);
 
     const auto encodeMatrix = [](const glm::mat3& matrix) -> std::string {
         std::ostringstream stringStream;
@@ -139,6 +206,7 @@ std::vector<uint32_t> CompileShader(const VideoFrameWrapper& src, const VideoFra
     options.AddMacroDefinition("SRC_PICTURE_CHROMA_OFFSET", std::to_string(src.GetChromaOffset()));
     options.AddMacroDefinition("SRC_PICTURE_U_OFFSET", std::to_string(src.GetCbOffset()));
     options.AddMacroDefinition("SRC_PICTURE_V_OFFSET", std::to_string(src.GetCrOffset()));
+    options.AddMacroDefinition("SRC_PICTURE_A_OFFSET", std::to_string(src.GetAlphaOffset()));
     options.AddMacroDefinition("SRC_PICTURE_BIT_DEPTH", std::to_string(src.GetBitDepth()));
     options.AddMacroDefinition("SRC_PICTURE_BYTE_DEPTH", std::to_string(src.GetByteDepth()));
     options.AddMacroDefinition("SRC_PICTURE_RANGE", std::to_string(static_cast<uint32_t>(src.isVideoFullRange)));
@@ -154,6 +222,10 @@ std::vector<uint32_t> CompileShader(const VideoFrameWrapper& src, const VideoFra
     options.AddMacroDefinition(
         "SRC_PICTURE_YUV_SCALE",
         encodeVector(GetLumaChromaScale(src.isVideoFullRange, src.GetBitDepth())));
+    options.AddMacroDefinition("SRC_PICTURE_TRANSFER", std::to_string(static_cast<uint32_t>(src.transferFunction)));
+    options.AddMacroDefinition("SRC_PICTURE_PRIMARIES", std::to_string(static_cast<uint32_t>(src.colorPrimaries)));
+    options.AddMacroDefinition("SRC_PICTURE_CHROMA_SITING", std::to_string(static_cast<uint32_t>(src.chromaSiting)));
+    options.AddMacroDefinition("SRC_PICTURE_FIELD_ORDER", std::to_string(static_cast<uint32_t>(src.fieldOrder)));
 
     const glm::mat3 dstRGBToYUVMatrix = GetLumaChromaMatrix(dst.lumaChromaMatrix);
     const glm::mat3 dstYUVToRGBMatrix = glm::inverse(dstRGBToYUVMatrix);
@@ -169,6 +241,9 @@ std::vector<uint32_t> CompileShader(const VideoFrameWrapper& src, const VideoFra
     options.AddMacroDefinition("DST_PICTURE_CHROMA_OFFSET", std::to_string(dst.GetChromaOffset()));
     options.AddMacroDefinition("DST_PICTURE_U_OFFSET", std::to_string(dst.GetCbOffset()));
     options.AddMacroDefinition("DST_PICTURE_V_OFFSET", std::to_string(dst.GetCrOffset()));
+    options.AddMacroDefinition("DST_PICTURE_A_OFFSET", std::to_string(dst.GetAlphaOffset()));
+    options.AddMacroDefinition("DST_PICTURE_PLANE1_OFFSET", std::to_string(dst.GetPlaneOffset(1)));
+    options.AddMacroDefinition("DST_PICTURE_PLANE2_OFFSET", std::to_string(dst.GetPlaneOffset(2)));
     options.AddMacroDefinition("DST_PICTURE_BIT_DEPTH", std::to_string(dst.GetBitDepth()));
     options.AddMacroDefinition("DST_PICTURE_BYTE_DEPTH", std::to_string(dst.GetByteDepth()));
     options.AddMacroDefinition("DST_PICTURE_RANGE", std::to_string(static_cast<uint32_t>(dst.isVideoFullRange)));
@@ -184,6 +259,93 @@ std::vector<uint32_t> CompileShader(const VideoFrameWrapper& src, const VideoFra
     options.AddMacroDefinition(
         "DST_PICTURE_YUV_SCALE",
         encodeVector(GetLumaChromaScale(dst.isVideoFullRange, dst.GetBitDepth())));
+    options.AddMacroDefinition("DST_PICTURE_TRANSFER", std::to_string(static_cast<uint32_t>(dst.transferFunction)));
+    options.AddMacroDefinition("DST_PICTURE_PRIMARIES", std::to_string(static_cast<uint32_t>(dst.colorPrimaries)));
+    options.AddMacroDefinition("DST_PICTURE_CHROMA_SITING", std::to_string(static_cast<uint32_t>(dst.chromaSiting)));
+    options.AddMacroDefinition("DST_PICTURE_FIELD_ORDER", std::to_string(static_cast<uint32_t>(dst.fieldOrder)));
+    options.AddMacroDefinition(
+        "GAMUT_CONVERSION_MATRIX",
+        encodeMatrix(GetGamutConversionMatrix(src.colorPrimaries, dst.colorPrimaries)));
+
+    // Layout-only conversions move integer samples as they are, skipping normalization and color math
+    const bool isSrcRGB = src.GetColorFormat() == ColorFormat::RGB;
+    const bool isDstRGB = dst.GetColorFormat() == ColorFormat::RGB;
+    const bool isPureRepack = isSrcRGB == isDstRGB && src.GetBitDepth() == dst.GetBitDepth() &&
+                              src.isVideoFullRange == dst.isVideoFullRange &&
+                              src.lumaChromaMatrix == dst.lumaChromaMatrix && HaveSameColorEncoding(src, dst) &&
+                              variant.colorLUTSize == 0 && variant.toneMapping == ToneMapping::None;
+    options.AddMacroDefinition("PURE_REPACK", isPureRepack ? "1" : "0");
+
+    // The source crop is mapped onto the destination placement after being rotated or mirrored by the source
+    // orientation, reads are clamped to the pixels the crop touches and destination pixels outside the placement get
+    // the fill color
+    const VideoFrameRect cropRect = src.GetCropRect();
+    const VideoFrameRect placementRect = dst.GetPlacementRect();
+    options.AddMacroDefinition("SRC_CROP_X", std::to_string(cropRect.x));
+    options.AddMacroDefinition("SRC_CROP_Y", std::to_string(cropRect.y));
+    options.AddMacroDefinition("SRC_CROP_WIDTH", std::to_string(cropRect.width));
+    options.AddMacroDefinition("SRC_CROP_HEIGHT", std::to_string(cropRect.height));
+    options.AddMacroDefinition("SRC_READ_MIN_X", std::to_string(static_cast<uint32_t>(std::floor(cropRect.x))));
+    options.AddMacroDefinition("SRC_READ_MIN_Y", std::to_string(static_cast<uint32_t>(std::floor(cropRect.y))));
+    options.AddMacroDefinition(
+        "SRC_READ_MAX_X",
+        std::to_string(static_cast<uint32_t>(std::ceil(cropRect.x + cropRect.width)) - 1));
+    options.AddMacroDefinition(
+        "SRC_READ_MAX_Y",
+        std::to_string(static_cast<uint32_t>(std::ceil(cropRect.y + cropRect.height)) - 1));
+    options.AddMacroDefinition("DST_PLACEMENT_X", std::to_string(static_cast<uint32_t>(placementRect.x)));
+    options.AddMacroDefinition("DST_PLACEMENT_Y", std::to_string(static_cast<uint32_t>(placementRect.y)));
+    options.AddMacroDefinition("DST_PLACEMENT_WIDTH", std::to_string(static_cast<uint32_t>(placementRect.width)));
+    options.AddMacroDefinition("DST_PLACEMENT_HEIGHT", std::to_string(static_cast<uint32_t>(placementRect.height)));
+    options.AddMacroDefinition("IS_SCALING", IsScaling(src, dst) ? "1" : "0");
+    options.AddMacroDefinition("DST_WRITES_PLACEMENT_ONLY", variant.writesPlacementOnly ? "1" : "0");
+    options.AddMacroDefinition("SRC_ORIENTATION", std::to_string(static_cast<uint32_t>(src.orientation)));
+
+    // Subsampled source chroma is interpolated at every luma sample, except when it keeps its resolution and siting,
+    // where replicating samples round trips exactly
+    const bool filtersSrcChroma =
+        src.IsChromaSubsampled() &&
+        (src.GetColorFormat() != dst.GetColorFormat() || src.chromaSiting != dst.chromaSiting || IsScaling(src, dst) ||
+         src.orientation != VideoFrameOrientation::Identity);
+    options.AddMacroDefinition("SRC_CHROMA_FILTER", filtersSrcChroma ? "1" : "0");
+
+    const glm::uvec3 fillPixel = GetFillPixel(dst, isPureRepack && isDstRGB);
+    options.AddMacroDefinition(
+        "DST_FILL_PIXEL",
+        "u32vec3(" + std::to_string(fillPixel.x) + "," + std::to_string(fillPixel.y) + "," +
+            std::to_string(fillPixel.z) + ")");
+
+    options.AddMacroDefinition("USE_FLOAT16_ARITHMETIC", variant.useFloat16Arithmetic ? "1" : "0");
+    options.AddMacroDefinition("USE_SUBGROUP_QUADS", variant.useSubgroupQuads ? "1" : "0");
+    options.AddMacroDefinition("USE_SAMPLED_IMAGES", variant.useSampledImages ? "1" : "0");
+    options.AddMacroDefinition("USE_SAMPLE_LUT", variant.useSampleLUT ? "1" : "0");
+    options.AddMacroDefinition("COLOR_LUT_SIZE", std::to_string(variant.colorLUTSize));
+    options.AddMacroDefinition("TONE_MAPPING", std::to_string(static_cast<uint32_t>(variant.toneMapping)));
+    options.AddMacroDefinition("TONE_MAPPING_SOURCE_PEAK", std::to_string(variant.toneMappingSourcePeak));
+    options.AddMacroDefinition("TONE_MAPPING_TARGET_PEAK", std::to_string(variant.toneMappingTargetPeak));
+    options.AddMacroDefinition("DITHERING", std::to_string(static_cast<uint32_t>(variant.dithering)));
+    options.AddMacroDefinition("DEINTERLACING", std::to_string(static_cast<uint32_t>(variant.deinterlacing)));
+    options.AddMacroDefinition("USE_OVERLAYS", variant.useOverlays ? "1" : "0");
+    options.AddMacroDefinition("OVERLAY_BLENDING", std::to_string(static_cast<uint32_t>(variant.overlayBlending)));
+    // Overlays are sRGB graphics, in BT.709 primaries
+    options.AddMacroDefinition(
+        "OVERLAY_GAMUT_CONVERSION_MATRIX",
+        encodeMatrix(GetGamutConversionMatrix(ColorPrimaries::BT709, dst.colorPrimaries)));
+    options.AddMacroDefinition("COLLECT_STATISTICS", variant.collectStatistics ? "1" : "0");
+    options.AddMacroDefinition("DETECT_CHANGES", variant.detectChanges ? "1" : "0");
+    options.AddMacroDefinition("CHANGE_DETECTION_TILE_SIZE", std::to_string(ChangeDetectionTileSize));
+
+    options.AddMacroDefinition("SCALER_PASS", std::to_string(static_cast<uint32_t>(variant.scalerPass)));
+    options.AddMacroDefinition("SCALER_TAP_COUNT_X", std::to_string(variant.scalerTapCountX));
+    options.AddMacroDefinition("SCALER_TAP_COUNT_Y", std::to_string(variant.scalerTapCountY));
+    options.AddMacroDefinition(
+        "SCALER_VERTICAL_TABLE_OFFSET",
+        std::to_string(GetScaledSize(src, dst).width * (variant.scalerTapCountX + 1)));
+    options.AddMacroDefinition("SCALER_BOX_RATIO_X", std::to_string(variant.scalerBoxRatioX));
+    options.AddMacroDefinition("SCALER_BOX_RATIO_Y", std::to_string(variant.scalerBoxRatioY));
+
+    options.AddMacroDefinition("DST_TENSOR_SCALE", encodeVector(variant.tensorScale));
+    options.AddMacroDefinition("DST_TENSOR_BIAS", encodeVector(variant.tensorBias));
 
     shaderc::SpvCompilationResult module = compiler.CompileGlslToSpv(
         reinterpret_cast<const char*>(shaderResource.buffer),
@@ -201,14 +363,35 @@ std::vector<uint32_t> CompileShader(const VideoFrameWrapper& src, const VideoFra
 
 ResultValue<VulkanDevice::VideoConversionPipelineResources> VulkanDevice::CreateVideoConversionPipeline(
     const VideoFrameWrapper& src,
-    const VulkanBuffer* srcBuffer,
     const VideoFrameWrapper& dst,
-    const VulkanBuffer* dstBuffer)
+    const VideoConversionPipelineBindings& bindings,
+    const VideoConverterConfig& config,
+    const bool writesPlacementOnly)
 {
     VideoConversionPipelineResources resources;
 
-    // Create pipeline layout bindings (one for srcBuffer, one for dstBuffer)
-    const std::vector<vk::DescriptorSetLayoutBinding> descriptorLayoutBindings{
+    // Source image planes are bound right after the buffers, matching `srcPlane<N>` in the shader, followed by the
+    // separable scaler weights and intermediate rows, the sample and color lookup tables, the overlays, the statistics
+    // and the tile hashes
+    constexpr uint32_t srcImageBindingOffset = 2;
+    constexpr uint32_t scalerWeightBinding = 5;
+    constexpr uint32_t scalerIntermediateBinding = 6;
+    constexpr uint32_t sampleLUTBinding = 7;
+    constexpr uint32_t colorLUTBinding = 8;
+    constexpr uint32_t overlayBinding = 9;
+    constexpr uint32_t statisticsBinding = 10;
+    constexpr uint32_t tileHashBinding = 11;
+    const bool useSampledImages = !bindings.srcImages.empty();
+    const bool useSeparableScaler = bindings.scalerWeightBuffer != nullptr;
+    const bool useSampleLUT = bindings.sampleLUTBuffer != nullptr;
+    const bool useColorLUT = bindings.colorLUTBuffer != nullptr;
+    const bool useOverlays = bindings.overlayBuffer != nullptr;
+    const bool collectStatistics = bindings.statisticsBuffer != nullptr;
+    const bool detectChanges = bindings.tileHashBuffer != nullptr;
+    const uint32_t srcImageCount = static_cast<uint32_t>(bindings.srcImages.size());
+
+    // Create pipeline layout bindings (one for srcBuffer, one for dstBuffer and one for each source image)
+    std::vector<vk::DescriptorSetLayoutBinding> descriptorLayoutBindings{
         vk::DescriptorSetLayoutBinding()
             .setBinding(0)
             .setDescriptorType(vk::DescriptorType::eStorageBuffer)
@@ -219,6 +402,57 @@ ResultValue<VulkanDevice::VideoConversionPipelineResources> VulkanDevice::Create
             .setDescriptorType(vk::DescriptorType::eStorageBuffer)
             .setStageFlags(vk::ShaderStageFlagBits::eCompute)
             .setDescriptorCount(1)};
+    for (uint32_t imageIndex = 0; imageIndex < srcImageCount; ++imageIndex) {
+        descriptorLayoutBindings.push_back(vk::DescriptorSetLayoutBinding()
+                                               .setBinding(srcImageBindingOffset + imageIndex)
+                                               .setDescriptorType(vk::DescriptorType::eCombinedImageSampler)
+                                               .setStageFlags(vk::ShaderStageFlagBits::eCompute)
+                                               .setDescriptorCount(1));
+    }
+    if (useSeparableScaler) {
+        for (const uint32_t binding : {scalerWeightBinding, scalerIntermediateBinding}) {
+            descriptorLayoutBindings.push_back(vk::DescriptorSetLayoutBinding()
+                                                   .setBinding(binding)
+                                                   .setDescriptorType(vk::DescriptorType::eStorageBuffer)
+                                                   .setStageFlags(vk::ShaderStageFlagBits::eCompute)
+                                                   .setDescriptorCount(1));
+        }
+    }
+    if (useSampleLUT) {
+        descriptorLayoutBindings.push_back(vk::DescriptorSetLayoutBinding()
+                                               .setBinding(sampleLUTBinding)
+                                               .setDescriptorType(vk::DescriptorType::eStorageBuffer)
+                                               .setStageFlags(vk::ShaderStageFlagBits::eCompute)
+                                               .setDescriptorCount(1));
+    }
+    if (useColorLUT) {
+        descriptorLayoutBindings.push_back(vk::DescriptorSetLayoutBinding()
+                                               .setBinding(colorLUTBinding)
+                                               .setDescriptorType(vk::DescriptorType::eStorageBuffer)
+                                               .setStageFlags(vk::ShaderStageFlagBits::eCompute)
+                                               .setDescriptorCount(1));
+    }
+    if (useOverlays) {
+        descriptorLayoutBindings.push_back(vk::DescriptorSetLayoutBinding()
+                                               .setBinding(overlayBinding)
+                                               .setDescriptorType(vk::DescriptorType::eStorageBuffer)
+                                               .setStageFlags(vk::ShaderStageFlagBits::eCompute)
+                                               .setDescriptorCount(1));
+    }
+    if (collectStatistics) {
+        descriptorLayoutBindings.push_back(vk::DescriptorSetLayoutBinding()
+                                               .setBinding(statisticsBinding)
+                                               .setDescriptorType(vk::DescriptorType::eStorageBuffer)
+                                               .setStageFlags(vk::ShaderStageFlagBits::eCompute)
+                                               .setDescriptorCount(1));
+    }
+    if (detectChanges) {
+        descriptorLayoutBindings.push_back(vk::DescriptorSetLayoutBinding()
+                                               .setBinding(tileHashBinding)
+                                               .setDescriptorType(vk::DescriptorType::eStorageBuffer)
+                                               .setStageFlags(vk::ShaderStageFlagBits::eCompute)
+                                               .setDescriptorCount(1));
+    }
 
     const vk::DescriptorSetLayoutCreateInfo descriptorLayoutInfo =
         vk::DescriptorSetLayoutCreateInfo().setBindings(descriptorLayoutBindings);
@@ -229,29 +463,111 @@ ResultValue<VulkanDevice::VideoConversionPipelineResources> VulkanDevice::Create
         vk::PipelineLayoutCreateInfo().setSetLayouts(resources.descriptorLayout);
     resources.pipelineLayout = PIXELWEAVE_ASSERT_VK(mLogicalDevice.createPipelineLayout(pipelineLayoutInfo));
 
-    std::vector<uint32_t> compiledShader = CompileShader(src, dst);
-    if (compiledShader.empty()) {
+    // Half precision can't represent samples above 10 bits with enough accuracy
+    constexpr uint32_t maxFloat16BitDepth = 10;
+    const bool useFloat16Arithmetic = config.allowFloat16Arithmetic && SupportsFloat16Arithmetic() &&
+                                      src.GetBitDepth() <= maxFloat16BitDepth &&
+                                      dst.GetBitDepth() <= maxFloat16BitDepth;
+    // V210 and 12-bit RGB groups span 6 and 8 pixels, which don't map onto 2x2 quads
+    const uint32_t packedGroupPixelCount = GetPackedGroupPixelCount(dst.pixelFormat);
+    // Co-sited and interlaced 4:2:0 chroma are filtered across neighboring blocks, out of reach of quad operations
+    const bool hasCositedDstChroma = dst.IsChromaSubsampled() && dst.chromaSiting != ChromaSiting::Center;
+    const bool hasFieldDstChroma = dst.IsInterlaced() && dst.GetColorFormat() == ColorFormat::YUV420;
+    const bool useSubgroupQuads = config.allowSubgroupOperations && SupportsSubgroupQuadOperations() &&
+                                  packedGroupPixelCount == 0 && !hasCositedDstChroma && !hasFieldDstChroma;
+    ShaderVariant variant;
+    variant.useFloat16Arithmetic = useFloat16Arithmetic;
+    variant.useSubgroupQuads = useSubgroupQuads;
+    variant.useSampledImages = useSampledImages;
+    variant.useSampleLUT = useSampleLUT;
+    variant.colorLUTSize = useColorLUT ? config.colorLUT.size : 0;
+    variant.tensorScale = glm::vec3(config.tensorScale[0], config.tensorScale[1], config.tensorScale[2]);
+    variant.tensorBias = glm::vec3(config.tensorBias[0], config.tensorBias[1], config.tensorBias[2]);
+    variant.toneMapping = config.toneMapping;
+    variant.toneMappingSourcePeak = config.toneMappingSourcePeak;
+    variant.toneMappingTargetPeak = config.toneMappingTargetPeak;
+    // Lossless and bit depth increasing conversions have nothing to dither
+    const bool altersColors = useColorLUT || config.toneMapping != ToneMapping::None;
+    variant.dithering = LosesSamplePrecision(src, dst, altersColors) ? config.dithering : Dithering::None;
+    // Interlaced destinations keep the fields as they are
+    variant.deinterlacing = src.IsInterlaced() && !dst.IsInterlaced() ? config.deinterlacing : Deinterlacing::Weave;
+    variant.useOverlays = useOverlays;
+    variant.overlayBlending = config.overlayBlending;
+    variant.writesPlacementOnly = writesPlacementOnly;
+    variant.collectStatistics = collectStatistics;
+    variant.detectChanges = detectChanges;
+    const VideoFrameRect cropRect = src.GetCropRect();
+    const ScaledSize scaledSize = GetScaledSize(src, dst);
+    if (useSeparableScaler) {
+        variant.scalerPass = ScalerPass::Vertical;
+        variant.scalerTapCountX = GetScalingTapCount(config.scalingFilter, cropRect.width, scaledSize.width);
+        variant.scalerTapCountY = GetScalingTapCount(config.scalingFilter, cropRect.height, scaledSize.height);
+    } else if (IsIntegerAreaScaling(config.scalingFilter, src, dst)) {
+        variant.scalerBoxRatioX = GetIntegerScalingRatio(static_cast<uint32_t>(cropRect.width), scaledSize.width);
+        variant.scalerBoxRatioY = GetIntegerScalingRatio(static_cast<uint32_t>(cropRect.height), scaledSize.height);
+    }
+
+    const auto createComputePipeline = [&](const ShaderVariant& shaderVariant,
+                                           vk::ShaderModule& shader,
+                                           vk::Pipeline& pipeline) -> Result {
+        std::vector<uint32_t> compiledShader = CompileShader(src, dst, shaderVariant);
+        if (compiledShader.empty()) {
+            return Result::ShaderCompilationFailed;
+        }
+        vk::ShaderModuleCreateInfo shaderCreateInfo = vk::ShaderModuleCreateInfo()
+                                                          .setCodeSize(compiledShader.size() * sizeof(uint32_t))
+                                                          .setPCode(compiledShader.data());
+        shader = PIXELWEAVE_ASSERT_VK(mLogicalDevice.createShaderModule(shaderCreateInfo));
+
+        const vk::PipelineShaderStageCreateInfo stageCreateInfo = vk::PipelineShaderStageCreateInfo()
+                                                                      .setStage(vk::ShaderStageFlagBits::eCompute)
+                                                                      .setModule(shader)
+                                                                      .setPName("main");
+        const vk::ComputePipelineCreateInfo computePipelineInfo =
+            vk::ComputePipelineCreateInfo().setLayout(resources.pipelineLayout).setStage(stageCreateInfo);
+        pipeline = PIXELWEAVE_ASSERT_VK(mLogicalDevice.createComputePipeline(nullptr, computePipelineInfo));
+        return Result::Success;
+    };
+    if (createComputePipeline(variant, resources.shader, resources.pipeline) != Result::Success) {
         DestroyVideoConversionPipeline(resources);
         return {Result::ShaderCompilationFailed, {}};
     }
-    vk::ShaderModuleCreateInfo shaderCreateInfo = vk::ShaderModuleCreateInfo()
-                                                      .setCodeSize(compiledShader.size() * sizeof(uint32_t))
-                                                      .setPCode(compiledShader.data());
-    resources.shader = PIXELWEAVE_ASSERT_VK(mLogicalDevice.createShaderModule(shaderCreateInfo));
-
-    const vk::PipelineShaderStageCreateInfo stageCreateInfo = vk::PipelineShaderStageCreateInfo()
-                                                                  .setStage(vk::ShaderStageFlagBits::eCompute)
-                                                                  .setModule(resources.shader)
-                                                                  .setPName("main");
-    const vk::ComputePipelineCreateInfo computePipelineInfo =
-        vk::ComputePipelineCreateInfo().setLayout(resources.pipelineLayout).setStage(stageCreateInfo);
-    resources.pipeline = PIXELWEAVE_ASSERT_VK(mLogicalDevice.createComputePipeline(nullptr, computePipelineInfo));
-
-    // Write descriptor sets for each buffer
-    const vk::DescriptorPoolSize poolSize =
-        vk::DescriptorPoolSize().setDescriptorCount(2).setType(vk::DescriptorType::eStorageBuffer);
+    if (useSeparableScaler) {
+        ShaderVariant horizontalScalerVariant = variant;
+        horizontalScalerVariant.scalerPass = ScalerPass::Horizontal;
+        if (createComputePipeline(
+                horizontalScalerVariant,
+                resources.horizontalScalerShader,
+                resources.horizontalScalerPipeline) != Result::Success) {
+            DestroyVideoConversionPipeline(resources);
+            return {Result::ShaderCompilationFailed, {}};
+        }
+    }
+
+    // Workgroups are 16x16 invocations, each converting a 2x2 block, a single pixel when using subgroup quads or a
+    // line of pixels when writing packed groups
+    constexpr uint32_t workgroupSize = 16;
+    constexpr uint32_t blockSize = 2;
+    if (packedGroupPixelCount != 0) {
+        resources.workgroupPixelExtent = vk::Extent2D(workgroupSize * packedGroupPixelCount, workgroupSize);
+    } else {
+        const uint32_t workgroupPixelCount = useSubgroupQuads ? workgroupSize : workgroupSize * blockSize;
+        resources.workgroupPixelExtent = vk::Extent2D(workgroupPixelCount, workgroupPixelCount);
+    }
+
+    // Write descriptor sets for each buffer and image
+    const uint32_t storageBufferCount = 2 + (useSeparableScaler ? 2 : 0) + (useSampleLUT ? 1 : 0) +
+                                        (useColorLUT ? 1 : 0) + (useOverlays ? 1 : 0) + (collectStatistics ? 1 : 0) +
+                                        (detectChanges ? 1 : 0);
+    std::vector<vk::DescriptorPoolSize> poolSizes{
+        vk::DescriptorPoolSize().setDescriptorCount(storageBufferCount).setType(vk::DescriptorType::eStorageBuffer)};
+    if (useSampledImages) {
+        poolSizes.push_back(
+            vk::DescriptorPoolSize().setDescriptorCount(srcImageCount).setType(
+                vk::DescriptorType::eCombinedImageSampler));
+    }
     const vk::DescriptorPoolCreateInfo poolInfo =
-        vk::DescriptorPoolCreateInfo().setPoolSizes(poolSize).setMaxSets(1).setFlags(
+        vk::DescriptorPoolCreateInfo().setPoolSizes(poolSizes).setMaxSets(1).setFlags(
             vk::DescriptorPoolCreateFlagBits::eFreeDescriptorSet);
     resources.descriptorPool = PIXELWEAVE_ASSERT_VK(mLogicalDevice.createDescriptorPool(poolInfo));
 
@@ -261,17 +577,93 @@ ResultValue<VulkanDevice::VideoConversionPipelineResources> VulkanDevice::Create
                                                                   .setDescriptorSetCount(1);
     resources.descriptorSet = PIXELWEAVE_ASSERT_VK(mLogicalDevice.allocateDescriptorSets(descriptorAllocInfo))[0];
 
-    const std::vector<vk::WriteDescriptorSet> imageWriteDescriptorSet{
+    std::vector<vk::WriteDescriptorSet> imageWriteDescriptorSet{
         vk::WriteDescriptorSet()
             .setDstSet(resources.descriptorSet)
             .setDescriptorType(vk::DescriptorType::eStorageBuffer)
             .setDstBinding(0)
-            .setBufferInfo(srcBuffer->GetDescriptorInfo()),
+            .setBufferInfo(bindings.srcBuffer->GetDescriptorInfo()),
         vk::WriteDescriptorSet()
             .setDstSet(resources.descriptorSet)
             .setDescriptorType(vk::DescriptorType::eStorageBuffer)
             .setDstBinding(1)
-            .setBufferInfo(dstBuffer->GetDescriptorInfo())};
+            .setBufferInfo(bindings.dstBuffer->GetDescriptorInfo())};
+    if (useSeparableScaler) {
+        imageWriteDescriptorSet.push_back(vk::WriteDescriptorSet()
+                                              .setDstSet(resources.descriptorSet)
+                                              .setDescriptorType(vk::DescriptorType::eStorageBuffer)
+                                              .setDstBinding(scalerWeightBinding)
+                                              .setBufferInfo(bindings.scalerWeightBuffer->GetDescriptorInfo()));
+        imageWriteDescriptorSet.push_back(vk::WriteDescriptorSet()
+                                              .setDstSet(resources.descriptorSet)
+                                              .setDescriptorType(vk::DescriptorType::eStorageBuffer)
+                                              .setDstBinding(scalerIntermediateBinding)
+                                              .setBufferInfo(bindings.scalerIntermediateBuffer->GetDescriptorInfo()));
+    }
+    if (useSampleLUT) {
+        imageWriteDescriptorSet.push_back(vk::WriteDescriptorSet()
+                                              .setDstSet(resources.descriptorSet)
+                                              .setDescriptorType(vk::DescriptorType::eStorageBuffer)
+                                              .setDstBinding(sampleLUTBinding)
+                                              .setBufferInfo(bindings.sampleLUTBuffer->GetDescriptorInfo()));
+    }
+    if (useColorLUT) {
+        imageWriteDescriptorSet.push_back(vk::WriteDescriptorSet()
+                                              .setDstSet(resources.descriptorSet)
+                                              .setDescriptorType(vk::DescriptorType::eStorageBuffer)
+                                              .setDstBinding(colorLUTBinding)
+                                              .setBufferInfo(bindings.colorLUTBuffer->GetDescriptorInfo()));
+    }
+    if (useOverlays) {
+        imageWriteDescriptorSet.push_back(vk::WriteDescriptorSet()
+                                              .setDstSet(resources.descriptorSet)
+                                              .setDescriptorType(vk::DescriptorType::eStorageBuffer)
+                                              .setDstBinding(overlayBinding)
+                                              .setBufferInfo(bindings.overlayBuffer->GetDescriptorInfo()));
+    }
+    if (collectStatistics) {
+        imageWriteDescriptorSet.push_back(vk::WriteDescriptorSet()
+                                              .setDstSet(resources.descriptorSet)
+                                              .setDescriptorType(vk::DescriptorType::eStorageBuffer)
+                                              .setDstBinding(statisticsBinding)
+                                              .setBufferInfo(bindings.statisticsBuffer->GetDescriptorInfo()));
+    }
+    if (detectChanges) {
+        imageWriteDescriptorSet.push_back(vk::WriteDescriptorSet()
+                                              .setDstSet(resources.descriptorSet)
+                                              .setDescriptorType(vk::DescriptorType::eStorageBuffer)
+                                              .setDstBinding(tileHashBinding)
+                                              .setBufferInfo(bindings.tileHashBuffer->GetDescriptorInfo()));
+    }
+
+    // Sampled images are filtered by the texture units, with texel centers aligned to pixel centers
+    std::vector<vk::DescriptorImageInfo> srcImageInfos;
+    if (useSampledImages) {
+        const vk::SamplerCreateInfo samplerInfo = vk::SamplerCreateInfo()
+                                                      .setMagFilter(vk::Filter::eLinear)
+                                                      .setMinFilter(vk::Filter::eLinear)
+                                                      .setMipmapMode(vk::SamplerMipmapMode::eNearest)
+                                                      .setAddressModeU(vk::SamplerAddressMode::eClampToEdge)
+                                                      .setAddressModeV(vk::SamplerAddressMode::eClampToEdge)
+                                                      .setAddressModeW(vk::SamplerAddressMode::eClampToEdge)
+                                                      .setUnnormalizedCoordinates(false);
+        resources.sampler = PIXELWEAVE_ASSERT_VK(mLogicalDevice.createSampler(samplerInfo));
+
+        srcImageInfos.reserve(srcImageCount);
+        for (const VulkanImage* srcImage : bindings.srcImages) {
+            srcImageInfos.push_back(vk::DescriptorImageInfo()
+                                        .setSampler(resources.sampler)
+                                        .setImageView(srcImage->GetImageView())
+                                        .setImageLayout(vk::ImageLayout::eShaderReadOnlyOptimal));
+        }
+        for (uint32_t imageIndex = 0; imageIndex < srcImageCount; ++imageIndex) {
+            imageWriteDescriptorSet.push_back(vk::WriteDescriptorSet()
+                                                  .setDstSet(resources.descriptorSet)
+                                                  .setDescriptorType(vk::DescriptorType::eCombinedImageSampler)
+                                                  .setDstBinding(srcImageBindingOffset + imageIndex)
+                                                  .setImageInfo(srcImageInfos[imageIndex]));
+        }
+    }
     mLogicalDevice.updateDescriptorSets(imageWriteDescriptorSet, {});
 
     return {Result::Success, resources};
@@ -283,10 +675,14 @@ void VulkanDevice::DestroyVideoConversionPipeline(VideoConversionPipelineResourc
         mLogicalDevice.freeDescriptorSets(pipelineResources.descriptorPool, pipelineResources.descriptorSet);
     }
     mLogicalDevice.destroyDescriptorPool(pipelineResources.descriptorPool);
+    mLogicalDevice.destroySampler(pipelineResources.sampler);
+    mLogicalDevice.destroyPipeline(pipelineResources.horizontalScalerPipeline);
+    mLogicalDevice.destroyShaderModule(pipelineResources.horizontalScalerShader);
     mLogicalDevice.destroyPipeline(pipelineResources.pipeline);
     mLogicalDevice.destroyShaderModule(pipelineResources.shader);
     mLogicalDevice.destroyPipelineLayout(pipelineResources.pipelineLayout);
     mLogicalDevice.destroyDescriptorSetLayout(pipelineResources.descriptorLayout);
+    pipelineResources = VideoConversionPipelineResources{};
 }
 
 vk::CommandBuffer VulkanDevice::CreateCommandBuffer()
@@ -315,6 +711,32 @@ bool VulkanDevice::SupportsTimestamps() const
     return deviceProperties.limits.timestampComputeAndGraphics;
 }
 
+bool VulkanDevice::SupportsFloat16Arithmetic() const
+{
+    return mSupportsFloat16Arithmetic;
+}
+
+bool VulkanDevice::SupportsSubgroupQuadOperations() const
+{
+    vk::PhysicalDeviceSubgroupProperties subgroupProperties{};
+    vk::PhysicalDeviceProperties2 deviceProperties = vk::PhysicalDeviceProperties2().setPNext(&subgroupProperties);
+    mPhysicalDevice.getProperties2(&deviceProperties);
+
+    const vk::SubgroupFeatureFlags requiredOperations =
+        vk::SubgroupFeatureFlagBits::eBasic | vk::SubgroupFeatureFlagBits::eQuad;
+    return (subgroupProperties.supportedStages & vk::ShaderStageFlagBits::eCompute) &&
+           (subgroupProperties.supportedOperations & requiredOperations) == requiredOperations &&
+           subgroupProperties.subgroupSize >= 4;
+}
+
+bool VulkanDevice::SupportsLinearFiltering(vk::Format format) const
+{
+    const vk::FormatFeatureFlags requiredFeatures = vk::FormatFeatureFlagBits::eSampledImageFilterLinear |
+                                                    vk::FormatFeatureFlagBits::eTransferDst;
+    const vk::FormatProperties formatProperties = mPhysicalDevice.getFormatProperties(format);
+    return (formatProperties.optimalTilingFeatures & requiredFeatures) == requiredFeatures;
+}
+
 vk::QueryPool VulkanDevice::CreateTimestampQueryPool(const uint32_t queryCount)
 {
     vk::QueryPoolCreateInfo queryPoolCreateInfo =
@@ -1,16 +1,22 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "Device.h"
 #include "VulkanBase.h"
 #include "VulkanBuffer.h"
+#include "VulkanImage.h"
 
 namespace Pixelweave
 {
 
 class VulkanInstance;
 
+// Pixels per group for destination formats whose pixels share words and are written a whole group per invocation,
+// or 0 for every other format
+uint32_t GetPackedGroupPixelCount(PixelFormat pixelFormat);
+
 class VulkanDevice : public Device
 {
 public:
@@ -19,12 +25,20 @@ public:
     VulkanDevice(const std::shared_ptr<VulkanInstance>& instance, vk::PhysicalDevice physicalDevice);
 
     VideoConverter* CreateVideoConverter() override;
+    VideoConverter* CreateVideoConverter(const VideoConverterConfig& config) override;
+    bool SupportsFloat16Arithmetic() const override;
+    bool SupportsSubgroupQuadOperations() const override;
 
     ResultValue<VulkanBuffer*> CreateBuffer(
         const vk::DeviceSize& size,
         const vk::BufferUsageFlags& usageFlags,
         const VmaAllocationCreateFlags& memoryFlags);
 
+    ResultValue<VulkanImage*> CreateImage(
+        const vk::Extent2D& extent,
+        const vk::Format& format,
+        const vk::ImageUsageFlags& usageFlags);
+
     // Pipeline handling
     struct VideoConversionPipelineResources {
         vk::DescriptorSetLayout descriptorLayout;
@@ -33,12 +47,36 @@ public:
         vk::Pipeline pipeline;
         vk::DescriptorPool descriptorPool;
         vk::DescriptorSet descriptorSet;
+        vk::Sampler sampler;
+        vk::Extent2D workgroupPixelExtent;
+        // First pass of the separable scaler, sharing the layout and descriptor set of the conversion pipeline
+        vk::ShaderModule horizontalScalerShader;
+        vk::Pipeline horizontalScalerPipeline;
+    };
+    // Resources bound to the conversion shader. Source images, one per plane, replace reads from `srcBuffer` when
+    // scaling through the sampled image path. The scaler buffers are only set when scaling with the separable filter,
+    // the sample lookup table only for range or bit depth only conversions, the color lookup table only when the
+    // converter has one, the overlay buffer only while overlays are set and the statistics and tile hash buffers only
+    // when the converter collects statistics or detects changes. Pipelines writing their placement only leave the rest
+    // of the destination to other pipelines, and are dispatched over the placement.
+    struct VideoConversionPipelineBindings {
+        const VulkanBuffer* srcBuffer = nullptr;
+        const VulkanBuffer* dstBuffer = nullptr;
+        std::vector<const VulkanImage*> srcImages;
+        const VulkanBuffer* scalerWeightBuffer = nullptr;
+        const VulkanBuffer* scalerIntermediateBuffer = nullptr;
+        const VulkanBuffer* sampleLUTBuffer = nullptr;
+        const VulkanBuffer* colorLUTBuffer = nullptr;
+        const VulkanBuffer* overlayBuffer = nullptr;
+        const VulkanBuffer* statisticsBuffer = nullptr;
+        const VulkanBuffer* tileHashBuffer = nullptr;
     };
     ResultValue<VideoConversionPipelineResources> CreateVideoConversionPipeline(
         const VideoFrameWrapper& src,
-        const VulkanBuffer* srcBuffer,
         const VideoFrameWrapper& dst,
-        const VulkanBuffer* dstBuffer);
+        const VideoConversionPipelineBindings& bindings,
+        const VideoConverterConfig& config,
+        bool writesPlacementOnly);
     void DestroyVideoConversionPipeline(VideoConversionPipelineResources& pipelineResources);
 
     vk::CommandBuffer CreateCommandBuffer();
@@ -46,6 +84,7 @@ public:
     void DestroyCommand(vk::CommandBuffer& commandBuffer);
 
     bool SupportsTimestamps() const;
+    bool SupportsLinearFiltering(vk::Format format) const;
     vk::QueryPool CreateTimestampQueryPool(const uint32_t queryCount);
     void ResetQueryPool(vk::QueryPool& queryPool, const uint32_t queryCount);
     std::vector<uint64_t> GetTimestampQueryResults(vk::QueryPool queryPool, const uint32_t queryCount);
@@ -68,6 +107,7 @@ private:
     vk::Queue mComputeQueue;
     vk::CommandPool mCommandPool;
     VmaAllocator mAllocator;
+    bool mSupportsFloat16Arithmetic;
 };
 
 }  // namespace Pixelweave
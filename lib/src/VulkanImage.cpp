@@ -0,0 +1,81 @@
+#include "VulkanImage.h"
+
+#include "DebugUtils.h"
+#include "VulkanDevice.h"
+
+namespace Pixelweave
+{
+
+ResultValue<VulkanImage*> VulkanImage::Create(
+    VulkanDevice* device,
+    const vk::Extent2D& extent,
+    const vk::Format& format,
+    const vk::ImageUsageFlags& usageFlags)
+{
+    VmaAllocator allocator = device->GetAllocator();
+    const vk::ImageCreateInfo imageCreateInfo = vk::ImageCreateInfo()
+                                                    .setImageType(vk::ImageType::e2D)
+                                                    .setFormat(format)
+                                                    .setExtent(vk::Extent3D(extent, 1))
+                                                    .setMipLevels(1)
+                                                    .setArrayLayers(1)
+                                                    .setSamples(vk::SampleCountFlagBits::e1)
+                                                    .setTiling(vk::ImageTiling::eOptimal)
+                                                    .setUsage(usageFlags)
+                                                    .setSharingMode(vk::SharingMode::eExclusive)
+                                                    .setInitialLayout(vk::ImageLayout::eUndefined);
+
+    VmaAllocationCreateInfo allocationInfo{};
+    allocationInfo.usage = VMA_MEMORY_USAGE_AUTO;
+
+    vk::Image imageHandle;
+    VmaAllocation allocation;
+    VkResult result = vmaCreateImage(
+        allocator,
+        (VkImageCreateInfo*)&imageCreateInfo,
+        &allocationInfo,
+        (VkImage*)&imageHandle,
+        &allocation,
+        nullptr);
+    if (result != VK_SUCCESS) {
+        return {Result::AllocationFailed, nullptr};
+    }
+
+    const vk::ImageViewCreateInfo imageViewCreateInfo =
+        vk::ImageViewCreateInfo()
+            .setImage(imageHandle)
+            .setViewType(vk::ImageViewType::e2D)
+            .setFormat(format)
+            .setSubresourceRange(vk::ImageSubresourceRange(vk::ImageAspectFlagBits::eColor, 0, 1, 0, 1));
+    const vk::ImageView imageView =
+        PIXELWEAVE_ASSERT_VK(device->GetLogicalDevice().createImageView(imageViewCreateInfo));
+
+    return {Result::Success, new VulkanImage(device, extent, format, imageHandle, allocation, imageView)};
+}
+
+VulkanImage::VulkanImage(
+    VulkanDevice* device,
+    vk::Extent2D extent,
+    vk::Format format,
+    vk::Image imageHandle,
+    VmaAllocation allocation,
+    vk::ImageView imageView)
+    : mDevice(device),
+      mExtent(extent),
+      mFormat(format),
+      mImageHandle(imageHandle),
+      mAllocation(allocation),
+      mImageView(imageView)
+{
+    mDevice->AddRef();
+}
+
+VulkanImage::~VulkanImage()
+{
+    VmaAllocator allocator = mDevice->GetAllocator();
+    mDevice->GetLogicalDevice().destroyImageView(mImageView);
+    vmaDestroyImage(allocator, mImageHandle, mAllocation);
+    mDevice->Release();
+}
+
+}  // namespace Pixelweave
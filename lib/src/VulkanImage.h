@@ -0,0 +1,43 @@
+#pragma once
+
+#include "RefCountPtr.h"
+#include "Result.h"
+#include "VulkanBase.h"
+
+namespace Pixelweave
+{
+class VulkanDevice;
+
+class VulkanImage : public RefCountPtr
+{
+public:
+    static ResultValue<VulkanImage*> Create(
+        VulkanDevice* device,
+        const vk::Extent2D& extent,
+        const vk::Format& format,
+        const vk::ImageUsageFlags& usageFlags);
+
+    const vk::Extent2D& GetExtent() const { return mExtent; }
+    const vk::Format& GetFormat() const { return mFormat; }
+    const vk::Image& GetImageHandle() const { return mImageHandle; }
+    const vk::ImageView& GetImageView() const { return mImageView; }
+
+private:
+    VulkanImage(
+        VulkanDevice* device,
+        vk::Extent2D extent,
+        vk::Format format,
+        vk::Image imageHandle,
+        VmaAllocation allocation,
+        vk::ImageView imageView);
+
+    ~VulkanImage() override;
+
+    VulkanDevice* mDevice;
+    vk::Extent2D mExtent;
+    vk::Format mFormat;
+    vk::Image mImageHandle;
+    VmaAllocation mAllocation;
+    vk::ImageView mImageView;
+};
+}  // namespace Pixelweave
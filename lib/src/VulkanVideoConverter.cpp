@@ -1,20 +1,29 @@
 #include "VulkanVideoConverter.h"
 
 #include <algorithm>
+#include <cmath>
+#include <cstring>
 
+#include "ColorSpaceUtils.h"
 #include "DebugUtils.h"
+#include "ScalingUtils.h"
 #include "Timer.h"
 
 namespace Pixelweave
 {
 
-VulkanVideoConverter::VulkanVideoConverter(VulkanDevice* device)
+VulkanVideoConverter::VulkanVideoConverter(VulkanDevice* device, const VideoConverterConfig& config)
     : mDevice(nullptr),
+      mConfig(config),
       mEnableBenchmark(false),
       mDstDeviceBuffer(nullptr),
       mDstLocalBuffer(nullptr),
-      mSrcDeviceBuffer(nullptr),
-      mSrcLocalBuffer(nullptr)
+      mColorLUTBuffer(nullptr),
+      mOverlayBuffer(nullptr),
+      mStatisticsBuffer(nullptr),
+      mTileHashBuffer(nullptr),
+      mPrevDstBuffer(nullptr),
+      mPrevDstBufferSize(0)
 {
     device->AddRef();
     mDevice = device;
@@ -46,12 +55,92 @@ Result VulkanVideoConverter::ValidateInput(const VideoFrameWrapper& src, const V
         return Result::InvalidOutputFormatError;
     }
 
+    // V210 lines must hold whole 16 byte groups of 6 pixels
+    if (dst.pixelFormat == PixelFormat::YCC10Bit422InterleavedV210) {
+        constexpr uint32_t groupByteSize = 16;
+        const uint32_t groupCount = (dst.width + 5) / 6;
+        if (dst.stride % groupByteSize != 0 || dst.stride < groupCount * groupByteSize) {
+            return Result::InvalidOutputResolutionError;
+        }
+    }
+
+    // 12-bit RGB lines must hold whole 36 byte groups of 8 pixels
+    if (dst.pixelFormat == PixelFormat::RGB12BitInterleavedBGRBE ||
+        dst.pixelFormat == PixelFormat::RGB12BitInterleavedBGRLE) {
+        constexpr uint32_t groupByteSize = 36;
+        const uint32_t groupCount = (dst.width + 7) / 8;
+        if (dst.stride % 4 != 0 || dst.stride < groupCount * groupByteSize) {
+            return Result::InvalidOutputResolutionError;
+        }
+    }
+
+    // Planar RGB samples wider than a byte are stored with aligned 16 and 32 bit writes
+    if (dst.GetColorFormat() == ColorFormat::RGB && dst.GetLayoutType() == VideoFrameLayout::Planar) {
+        const uint32_t byteDepth = dst.GetByteDepth();
+        if (dst.stride % byteDepth != 0 || dst.GetPlaneOffset(1) % byteDepth != 0 ||
+            dst.GetPlaneOffset(2) % byteDepth != 0) {
+            return Result::InvalidOutputResolutionError;
+        }
+    }
+
+    // Crops must lie within the source and placements within the destination, aligned to whole pixels
+    const VideoFrameRect cropRect = src.GetCropRect();
+    if (cropRect.x < 0.0f || cropRect.y < 0.0f || cropRect.x + cropRect.width > static_cast<float>(src.width) ||
+        cropRect.y + cropRect.height > static_cast<float>(src.height)) {
+        return Result::InvalidInputResolutionError;
+    }
+    const VideoFrameRect placementRect = dst.GetPlacementRect();
+    const bool isPlacementAligned = std::floor(placementRect.x) == placementRect.x &&
+                                    std::floor(placementRect.y) == placementRect.y &&
+                                    std::floor(placementRect.width) == placementRect.width &&
+                                    std::floor(placementRect.height) == placementRect.height;
+    if (!isPlacementAligned || placementRect.x < 0.0f || placementRect.y < 0.0f ||
+        placementRect.x + placementRect.width > static_cast<float>(dst.width) ||
+        placementRect.y + placementRect.height > static_cast<float>(dst.height)) {
+        return Result::InvalidOutputResolutionError;
+    }
+
+    return Result::Success;
+}
+
+Result VulkanVideoConverter::ValidateTiles(const std::vector<VideoTile>& tiles, const VideoFrameWrapper& dst)
+{
+    if (tiles.empty()) {
+        return Result::InvalidTileError;
+    }
+
+    // Tiles cover whole blocks or packed groups, so no two passes write the same word. Interlaced 4:2:0 chroma is
+    // filtered over pairs of blocks, whose lines alternate between fields, so tiles cover whole pairs.
+    const uint32_t packedGroupPixelCount = GetPackedGroupPixelCount(dst.pixelFormat);
+    const uint32_t alignmentX = packedGroupPixelCount != 0 ? packedGroupPixelCount : 2;
+    const bool hasFieldDstChroma = dst.IsInterlaced() && dst.GetColorFormat() == ColorFormat::YUV420;
+    const uint32_t alignmentY = hasFieldDstChroma ? 4 : 2;
+    const auto isAligned = [](float value, uint32_t alignment) {
+        return std::floor(value) == value && static_cast<uint32_t>(value) % alignment == 0;
+    };
+    for (size_t tileIndex = 0; tileIndex < tiles.size(); ++tileIndex) {
+        const VideoFrameRect& rect = tiles[tileIndex].rect;
+        // The right and bottom edges can also end with the frame, where blocks and groups are cut short anyway
+        const bool isRightAligned = isAligned(rect.x + rect.width, alignmentX) || rect.x + rect.width == dst.width;
+        const bool isBottomAligned = isAligned(rect.y + rect.height, alignmentY) || rect.y + rect.height == dst.height;
+        if (rect.width <= 0.0f || rect.height <= 0.0f || !isAligned(rect.x, alignmentX) ||
+            !isAligned(rect.y, alignmentY) || !isRightAligned || !isBottomAligned) {
+            return Result::InvalidTileError;
+        }
+        for (size_t otherIndex = 0; otherIndex < tileIndex; ++otherIndex) {
+            const VideoFrameRect& other = tiles[otherIndex].rect;
+            if (rect.x < other.x + other.width && other.x < rect.x + rect.width && rect.y < other.y + other.height &&
+                other.y < rect.y + rect.height) {
+                return Result::InvalidTileError;
+            }
+        }
+    }
     return Result::Success;
 }
 
 bool VulkanVideoConverter::IsInputFormatSupported(PixelFormat inputFormat)
 {
-    static_assert(AllPixelFormats.size() == 25);
+    static_assert(AllPixelFormats.size() == 37);
     std::vector<PixelFormat> validInputFormats{
         PixelFormat::RGB8BitInterleavedBGRA,
         PixelFormat::RGB8BitInterleavedRGBA,
@@ -78,6 +167,14 @@ bool VulkanVideoConverter::IsInputFormatSupported(PixelFormat inputFormat)
         PixelFormat::RGB12BitInterleavedBGRBE,
         PixelFormat::RGB12BitInterleavedBGRLE,
         PixelFormat::YCC16Bit422BiplanarP216,
+        PixelFormat::YCC8Bit422InterleavedYUY2,
+        PixelFormat::YCC10Bit422InterleavedY210,
+        PixelFormat::YCC10Bit444InterleavedV410,
+        PixelFormat::RGB8BitInterleavedRGB,
+        PixelFormat::RGB8BitInterleavedBGR,
+        PixelFormat::RGB16BitInterleavedRGB,
+        PixelFormat::YCCA8Bit420Planar,
+        PixelFormat::YCCA8Bit444Planar,
     };
     return std::any_of(validInputFormats.begin(), validInputFormats.end(), [&](const PixelFormat& format) {
         return inputFormat == format;
@@ -86,40 +183,391 @@ bool VulkanVideoConverter::IsInputFormatSupported(PixelFormat inputFormat)
 
 bool VulkanVideoConverter::IsOutputFormatSupported(PixelFormat outputFormat)
 {
-    static_assert(AllPixelFormats.size() == 25);
+    static_assert(AllPixelFormats.size() == 37);
     std::vector<PixelFormat> validOutputFormats{
         PixelFormat::RGB8BitInterleavedBGRA,
+        PixelFormat::RGB8BitInterleavedRGBA,
+        PixelFormat::RGB8BitInterleavedARGB,
         PixelFormat::YCC8Bit420Planar,
         PixelFormat::YCC8Bit422Planar,
         PixelFormat::YCC8Bit444Planar,
+        PixelFormat::YCC8Bit420BiplanarNV12,
         PixelFormat::YCC8Bit422InterleavedUYVY,
+        PixelFormat::RGB10BitInterleavedRGBXBE,
+        PixelFormat::RGB10BitInterleavedRGBXLE,
         PixelFormat::RGB10BitInterleavedXRGBBE,
+        PixelFormat::RGB10BitInterleavedXRGBLE,
+        PixelFormat::RGB10BitInterleavedXBGRBE,
+        PixelFormat::RGB10BitInterleavedXBGRLE,
         PixelFormat::YCC10Bit420Planar,
         PixelFormat::YCC10Bit422Planar,
         PixelFormat::YCC10Bit444Planar,
+        PixelFormat::YCC10Bit420BiplanarP010,
+        PixelFormat::YCC10Bit422BiplanarP210,
+        PixelFormat::YCC10Bit444BiplanarP410,
+        PixelFormat::YCC10Bit422InterleavedV210,
+        PixelFormat::RGB12BitInterleavedBGRBE,
+        PixelFormat::RGB12BitInterleavedBGRLE,
+        PixelFormat::YCC16Bit422BiplanarP216,
+        PixelFormat::YCCA8Bit420Planar,
+        PixelFormat::YCCA8Bit444Planar,
+        PixelFormat::RGB8BitPlanarGBR,
+        PixelFormat::RGB16BitPlanarGBR,
+        PixelFormat::RGBFloat16PlanarNCHW,
+        PixelFormat::RGBFloat32PlanarNCHW,
     };
     return std::any_of(validOutputFormats.begin(), validOutputFormats.end(), [&](const PixelFormat& format) {
         return outputFormat == format;
     });
 }
 
-Result VulkanVideoConverter::InitResources(const VideoFrameWrapper& src, VideoFrameWrapper& dst)
+std::vector<VulkanVideoConverter::SampledImagePlane> VulkanVideoConverter::GetSampledImagePlanes(
+    const VideoFrameWrapper& src,
+    const VideoFrameWrapper& dst) const
 {
-    // Create source buffer and copy CPU memory into it
-    const vk::DeviceSize srcBufferSize = src.GetBufferSize();
+    // Texture units only pay off when scaling, and beyond 2x downscaling their 2x2 footprint undersamples the source
+    const VideoFrameRect cropRect = src.GetCropRect();
+    const ScaledSize scaledSize = GetScaledSize(src, dst);
+    const bool isWithinFilterFootprint = cropRect.width <= static_cast<float>(scaledSize.width * 2) &&
+                                         cropRect.height <= static_cast<float>(scaledSize.height * 2);
+    const bool isBilinear = mConfig.scalingFilter == ScalingFilter::Bilinear;
+    // Filtering interlaced planes would blend lines of both fields, they're deinterlaced on read instead
+    if (!mConfig.allowSampledImages || !IsScaling(src, dst) || !isWithinFilterFootprint || !isBilinear ||
+        src.IsInterlaced()) {
+        return {};
+    }
+
+    const vk::Extent2D lumaExtent(src.width, src.height);
+    const vk::Extent2D chromaExtent(src.GetChromaWidth(), src.GetChromaHeight());
+    std::vector<SampledImagePlane> planes;
+    static_assert(AllPixelFormats.size() == 37);
+    switch (src.pixelFormat) {
+        // Alpha is sampled from the same texture, other formats with alpha read it from the source buffer, which is
+        // left in host memory on this path, so they aren't sampled
+        case PixelFormat::RGB8BitInterleavedBGRA:
+        case PixelFormat::RGB8BitInterleavedRGBA:
+            planes = {{vk::Format::eR8G8B8A8Unorm, lumaExtent, 0, src.stride, 4}};
+            break;
+        case PixelFormat::YCC8Bit420Planar:
+        case PixelFormat::YCC8Bit420PlanarYV12:
+        case PixelFormat::YCC8Bit422Planar:
+        case PixelFormat::YCC8Bit444Planar:
+            planes = {
+                {vk::Format::eR8Unorm, lumaExtent, 0, src.stride, 1},
+                {vk::Format::eR8Unorm, chromaExtent, src.GetCbOffset(), src.GetChromaStride(), 1},
+                {vk::Format::eR8Unorm, chromaExtent, src.GetCrOffset(), src.GetChromaStride(), 1}};
+            break;
+        case PixelFormat::YCC10Bit420Planar:
+        case PixelFormat::YCC10Bit422Planar:
+        case PixelFormat::YCC10Bit444Planar:
+            planes = {
+                {vk::Format::eR16Unorm, lumaExtent, 0, src.stride, 2},
+                {vk::Format::eR16Unorm, chromaExtent, src.GetCbOffset(), src.GetChromaStride(), 2},
+                {vk::Format::eR16Unorm, chromaExtent, src.GetCrOffset(), src.GetChromaStride(), 2}};
+            break;
+        // Interleaved CbCr lines span twice the chroma stride
+        case PixelFormat::YCC8Bit420BiplanarNV12:
+            planes = {
+                {vk::Format::eR8Unorm, lumaExtent, 0, src.stride, 1},
+                {vk::Format::eR8G8Unorm, chromaExtent, src.GetChromaOffset(), src.GetChromaStride() * 2, 2}};
+            break;
+        case PixelFormat::YCC10Bit420BiplanarP010:
+        case PixelFormat::YCC10Bit422BiplanarP210:
+        case PixelFormat::YCC10Bit444BiplanarP410:
+        case PixelFormat::YCC16Bit422BiplanarP216:
+            planes = {
+                {vk::Format::eR16Unorm, lumaExtent, 0, src.stride, 2},
+                {vk::Format::eR16G16Unorm, chromaExtent, src.GetChromaOffset(), src.GetChromaStride() * 2, 4}};
+            break;
+        default:
+            return {};
+    }
+
+    // Buffer to image copies need 4 byte aligned offsets and rows made of whole texels
+    for (const SampledImagePlane& plane : planes) {
+        const bool isCopyAligned = plane.bufferOffset % 4 == 0 && plane.bufferRowPitch % plane.texelSize == 0 &&
+                                   plane.bufferRowPitch / plane.texelSize >= plane.extent.width;
+        if (!isCopyAligned || !mDevice->SupportsLinearFiltering(plane.format)) {
+            return {};
+        }
+    }
+    return planes;
+}
+
+std::vector<vk::BufferCopy> VulkanVideoConverter::GetDirectCopyRegions(
+    const VideoFrameWrapper& src,
+    const VideoFrameWrapper& dst)
+{
+    if (src.pixelFormat != dst.pixelFormat || src.width != dst.width || src.height != dst.height ||
+        src.isVideoFullRange != dst.isVideoFullRange || src.lumaChromaMatrix != dst.lumaChromaMatrix ||
+        !HaveSameColorEncoding(src, dst) || src.chromaSiting != dst.chromaSiting || src.fieldOrder != dst.fieldOrder ||
+        src.IsCropped() || dst.IsPlaced() || src.orientation != VideoFrameOrientation::Identity) {
+        return {};
+    }
+
+    // Rows are copied up to the smaller stride, the padding is zeroed by `InitDirectCopyResources`
+    std::vector<vk::BufferCopy> regions;
+    const auto addPlaneRegions = [&](vk::DeviceSize srcOffset,
+                                     vk::DeviceSize dstOffset,
+                                     vk::DeviceSize srcRowPitch,
+                                     vk::DeviceSize dstRowPitch,
+                                     uint32_t rowCount) {
+        if (srcRowPitch == dstRowPitch) {
+            regions.push_back(vk::BufferCopy(srcOffset, dstOffset, srcRowPitch * rowCount));
+            return;
+        }
+        const vk::DeviceSize rowSize = std::min(srcRowPitch, dstRowPitch);
+        for (uint32_t row = 0; row < rowCount; ++row) {
+            regions.push_back(vk::BufferCopy(srcOffset + row * srcRowPitch, dstOffset + row * dstRowPitch, rowSize));
+        }
+    };
+
+    addPlaneRegions(0, 0, src.stride, dst.stride, src.height);
+    switch (src.GetLayoutType()) {
+        case VideoFrameLayout::Planar:
+            addPlaneRegions(
+                src.GetCbOffset(),
+                dst.GetCbOffset(),
+                src.GetChromaStride(),
+                dst.GetChromaStride(),
+                src.GetChromaHeight());
+            addPlaneRegions(
+                src.GetCrOffset(),
+                dst.GetCrOffset(),
+                src.GetChromaStride(),
+                dst.GetChromaStride(),
+                src.GetChromaHeight());
+            if (src.GetAlphaOffset() != 0) {
+                addPlaneRegions(src.GetAlphaOffset(), dst.GetAlphaOffset(), src.stride, dst.stride, src.height);
+            }
+            break;
+        // Interleaved CbCr lines span twice the chroma stride
+        case VideoFrameLayout::Biplanar:
+            addPlaneRegions(
+                src.GetChromaOffset(),
+                dst.GetChromaOffset(),
+                src.GetChromaStride() * 2,
+                dst.GetChromaStride() * 2,
+                src.GetChromaHeight());
+            break;
+        default:
+        case VideoFrameLayout::Interleaved:
+            break;
+    }
+
+    // Custom buffer sizes or plane offsets could place rows outside either buffer
+    for (const vk::BufferCopy& region : regions) {
+        if (region.srcOffset + region.size > src.GetBufferSize() ||
+            region.dstOffset + region.size > dst.GetBufferSize()) {
+            return {};
+        }
+    }
+    return regions;
+}
+
+Result VulkanVideoConverter::InitDirectCopyResources(
+    const VideoFrameWrapper& src,
+    const VideoFrameWrapper& dst,
+    const std::vector<vk::BufferCopy>& copyRegions)
+{
+    mPasses.resize(1);
+    ConversionPass& pass = mPasses.front();
     auto [srcLocalBufferResult, srcLocalBuffer] = mDevice->CreateBuffer(
-        srcBufferSize,
+        src.GetBufferSize(),
         vk::BufferUsageFlagBits::eTransferSrc,
         VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT);
-    mSrcLocalBuffer = srcLocalBuffer;
+    pass.srcLocalBuffer = srcLocalBuffer;
+
+    auto [dstLocalBufferResult, dstLocalBuffer] = mDevice->CreateBuffer(
+        dst.GetBufferSize(),
+        vk::BufferUsageFlagBits::eTransferDst,
+        VMA_ALLOCATION_CREATE_HOST_ACCESS_RANDOM_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT);
+    mDstLocalBuffer = dstLocalBuffer;
+
+    if (!(srcLocalBufferResult == Result::Success && dstLocalBufferResult == Result::Success)) {
+        CleanUp();
+        return Result::AllocationFailed;
+    }
+
+    mCommand = mDevice->CreateCommandBuffer();
+
+    // Record command buffer, the copy is reported as the device transfer time and the remaining stages take no time
+    {
+        const vk::CommandBufferBeginInfo commandBeginInfo = vk::CommandBufferBeginInfo();
+        PIXELWEAVE_ASSERT_VK(mCommand.begin(commandBeginInfo));
+
+        if (mEnableBenchmark) {
+            mTimestampQueryPool = mDevice->CreateTimestampQueryPool(sTimemestampQueryCount);
+            mCommand.writeTimestamp(vk::PipelineStageFlagBits::eTopOfPipe, mTimestampQueryPool, sTimestampStartIndex);
+        }
+
+        // Row by row copies leave the destination padding out, it's zeroed like the conversion shader does for V210
+        vk::DeviceSize copiedSize = 0;
+        for (const vk::BufferCopy& region : copyRegions) {
+            copiedSize += region.size;
+        }
+        if (copiedSize < dst.GetBufferSize()) {
+            mCommand.fillBuffer(mDstLocalBuffer->GetBufferHandle(), 0, VK_WHOLE_SIZE, 0);
+            const vk::BufferMemoryBarrier fillBarrier = vk::BufferMemoryBarrier()
+                                                            .setSrcAccessMask(vk::AccessFlagBits::eTransferWrite)
+                                                            .setDstAccessMask(vk::AccessFlagBits::eTransferWrite)
+                                                            .setBuffer(mDstLocalBuffer->GetBufferHandle())
+                                                            .setOffset(0)
+                                                            .setSize(VK_WHOLE_SIZE);
+            mCommand.pipelineBarrier(
+                vk::PipelineStageFlagBits::eTransfer,
+                vk::PipelineStageFlagBits::eTransfer,
+                vk::DependencyFlags{},
+                {},
+                fillBarrier,
+                {});
+        }
+        mCommand.copyBuffer(pass.srcLocalBuffer->GetBufferHandle(), mDstLocalBuffer->GetBufferHandle(), copyRegions);
+
+        if (mEnableBenchmark) {
+            for (const uint32_t timestampIndex :
+                 {sTimestampSrcTransferDoneIndex, sTimestampConvertIndex, sTimestampDstTransferDoneIndex}) {
+                mCommand.writeTimestamp(vk::PipelineStageFlagBits::eBottomOfPipe, mTimestampQueryPool, timestampIndex);
+            }
+        }
 
-    auto [srcDeviceBufferResult, srcDeviceBuffer] = mDevice->CreateBuffer(
+        PIXELWEAVE_ASSERT_VK(mCommand.end());
+    }
+    return Result::Success;
+}
+
+Result VulkanVideoConverter::InitPassResources(
+    const VideoFrameWrapper& src,
+    const VideoFrameWrapper& dst,
+    ConversionPass& pass)
+{
+    pass.srcImagePlanes = GetSampledImagePlanes(src, dst);
+    const bool useSampledImages = !pass.srcImagePlanes.empty();
+
+    // Create source buffer and copy CPU memory into it. When sampling from images, planes are copied straight from
+    // this buffer, which is also bound in place of the unused device buffer.
+    const vk::DeviceSize srcBufferSize = src.GetBufferSize();
+    auto [srcLocalBufferResult, srcLocalBuffer] = mDevice->CreateBuffer(
         srcBufferSize,
-        vk::BufferUsageFlagBits::eStorageBuffer | vk::BufferUsageFlagBits::eTransferDst,
-        VMA_ALLOCATION_CREATE_DEDICATED_MEMORY_BIT);
-    mSrcDeviceBuffer = srcDeviceBuffer;
+        useSampledImages ? vk::BufferUsageFlagBits::eTransferSrc | vk::BufferUsageFlagBits::eStorageBuffer
+                         : vk::BufferUsageFlagBits::eTransferSrc,
+        VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT);
+    pass.srcLocalBuffer = srcLocalBuffer;
+
+    Result srcDeviceBufferResult = Result::Success;
+    if (!useSampledImages) {
+        auto [deviceBufferResult, srcDeviceBuffer] = mDevice->CreateBuffer(
+            srcBufferSize,
+            vk::BufferUsageFlagBits::eStorageBuffer | vk::BufferUsageFlagBits::eTransferDst,
+            VMA_ALLOCATION_CREATE_DEDICATED_MEMORY_BIT);
+        srcDeviceBufferResult = deviceBufferResult;
+        pass.srcDeviceBuffer = srcDeviceBuffer;
+    }
+
+    Result srcImagesResult = Result::Success;
+    for (const SampledImagePlane& plane : pass.srcImagePlanes) {
+        auto [srcImageResult, srcImage] = mDevice->CreateImage(
+            plane.extent,
+            plane.format,
+            vk::ImageUsageFlagBits::eTransferDst | vk::ImageUsageFlagBits::eSampled);
+        if (srcImageResult != Result::Success) {
+            srcImagesResult = srcImageResult;
+            break;
+        }
+        pass.srcImages.push_back(srcImage);
+    }
+
+    // Filters other than bilinear scale in two separable passes: source rows are filtered horizontally into an
+    // intermediate buffer, which the conversion pass then filters vertically. Integer area reductions average source
+    // blocks directly in the conversion pass instead.
+    const bool useSeparableScaler = IsScaling(src, dst) && mConfig.scalingFilter != ScalingFilter::Bilinear &&
+                                    !IsIntegerAreaScaling(mConfig.scalingFilter, src, dst);
+    Result scalerBuffersResult = Result::Success;
+    if (useSeparableScaler) {
+        const std::vector<uint32_t> scalerTable = GetSeparableScalerTable(mConfig.scalingFilter, src, dst);
+        auto [weightBufferResult, scalerWeightBuffer] = mDevice->CreateBuffer(
+            scalerTable.size() * sizeof(uint32_t),
+            vk::BufferUsageFlagBits::eStorageBuffer,
+            VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT);
+        pass.scalerWeightBuffer = scalerWeightBuffer;
+
+        // One RGB or YUV triplet of floats per scaled column and source row
+        const vk::DeviceSize intermediateBufferSize =
+            static_cast<vk::DeviceSize>(GetScaledSize(src, dst).width) * src.height * 3 * sizeof(float);
+        auto [intermediateBufferResult, scalerIntermediateBuffer] = mDevice->CreateBuffer(
+            intermediateBufferSize,
+            vk::BufferUsageFlagBits::eStorageBuffer,
+            VMA_ALLOCATION_CREATE_DEDICATED_MEMORY_BIT);
+        pass.scalerIntermediateBuffer = scalerIntermediateBuffer;
+
+        if (weightBufferResult != Result::Success) {
+            scalerBuffersResult = weightBufferResult;
+        } else if (intermediateBufferResult != Result::Success) {
+            scalerBuffersResult = intermediateBufferResult;
+        } else {
+            // Weights only depend on the frame sizes, so they are uploaded once per configuration
+            uint8_t* mappedWeightBuffer = pass.scalerWeightBuffer->MapBuffer();
+            std::copy_n(
+                reinterpret_cast<const uint8_t*>(scalerTable.data()),
+                scalerTable.size() * sizeof(uint32_t),
+                mappedWeightBuffer);
+            pass.scalerWeightBuffer->UnmapBuffer();
+        }
+    }
+
+    // Range or bit depth only conversions look destination samples up instead of doing the color math per sample,
+    // unless every sample gets its own dither threshold
+    const bool altersColors = !mConfig.colorLUT.IsEmpty() || mConfig.toneMapping != ToneMapping::None;
+    const bool isDithered = mConfig.dithering != Dithering::None && LosesSamplePrecision(src, dst, altersColors);
+    Result sampleLUTBufferResult = Result::Success;
+    if (IsPerChannelConversion(src, dst) && !altersColors && !isDithered) {
+        const std::vector<uint32_t> sampleLUT = GetPerChannelConversionLUT(src, dst);
+        auto [lutBufferResult, sampleLUTBuffer] = mDevice->CreateBuffer(
+            sampleLUT.size() * sizeof(uint32_t),
+            vk::BufferUsageFlagBits::eStorageBuffer,
+            VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT);
+        sampleLUTBufferResult = lutBufferResult;
+        pass.sampleLUTBuffer = sampleLUTBuffer;
+        if (sampleLUTBufferResult == Result::Success) {
+            uint8_t* mappedLUTBuffer = pass.sampleLUTBuffer->MapBuffer();
+            std::copy_n(
+                reinterpret_cast<const uint8_t*>(sampleLUT.data()),
+                sampleLUT.size() * sizeof(uint32_t),
+                mappedLUTBuffer);
+            pass.sampleLUTBuffer->UnmapBuffer();
+        }
+    }
+
+    if (!(srcLocalBufferResult == Result::Success && srcDeviceBufferResult == Result::Success &&
+          srcImagesResult == Result::Success && scalerBuffersResult == Result::Success &&
+          sampleLUTBufferResult == Result::Success)) {
+        return Result::AllocationFailed;
+    }
+    return Result::Success;
+}
+
+Result VulkanVideoConverter::InitResources(const std::vector<PassFrames>& passFrames)
+{
+    if (!mConfig.colorLUT.IsValid()) {
+        return Result::InvalidColorLUTError;
+    }
+
+    // Identical formats and sizes need no shader, planes are copied row by row between the host visible buffers.
+    // Color lookup tables and tone mapping alter colors even then, overlays cover pixels and statistics and tile hashes
+    // are gathered by the shader.
+    const bool useColorLUT = !mConfig.colorLUT.IsEmpty();
+    const bool altersColors = useColorLUT || mConfig.toneMapping != ToneMapping::None;
+    const bool useOverlays = !mOverlayWords.empty();
+    const std::vector<vk::BufferCopy> directCopyRegions =
+        altersColors || useOverlays || mConfig.collectStatistics || mConfig.detectChanges || passFrames.size() != 1
+            ? std::vector<vk::BufferCopy>()
+            : GetDirectCopyRegions(passFrames.front().src, passFrames.front().dst);
+    if (!directCopyRegions.empty()) {
+        return InitDirectCopyResources(passFrames.front().src, passFrames.front().dst, directCopyRegions);
+    }
 
     // Create CPU readable dest buffer to do conversions in
+    const VideoFrameWrapper& dst = passFrames.front().dst;
     const vk::DeviceSize dstBufferSize = dst.GetBufferSize();
     auto [dstLocalBufferResult, dstLocalBuffer] = mDevice->CreateBuffer(
         dstBufferSize,
@@ -133,20 +581,114 @@ Result VulkanVideoConverter::InitResources(const VideoFrameWrapper& src, VideoFr
         VMA_ALLOCATION_CREATE_DEDICATED_MEMORY_BIT);
     mDstDeviceBuffer = dstDeviceBuffer;
 
-    if (!(srcLocalBufferResult == Result::Success && srcDeviceBufferResult == Result::Success &&
-          dstLocalBufferResult == Result::Success && dstDeviceBufferResult == Result::Success)) {
+    // The color lookup table only depends on the converter configuration, but follows the other buffers' lifetime
+    Result colorLUTBufferResult = Result::Success;
+    if (useColorLUT) {
+        const std::vector<float>& colorLUT = mConfig.colorLUT.entries;
+        auto [lutBufferResult, colorLUTBuffer] = mDevice->CreateBuffer(
+            colorLUT.size() * sizeof(float),
+            vk::BufferUsageFlagBits::eStorageBuffer,
+            VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT);
+        colorLUTBufferResult = lutBufferResult;
+        mColorLUTBuffer = colorLUTBuffer;
+        if (colorLUTBufferResult == Result::Success) {
+            uint8_t* mappedLUTBuffer = mColorLUTBuffer->MapBuffer();
+            std::copy_n(
+                reinterpret_cast<const uint8_t*>(colorLUT.data()),
+                colorLUT.size() * sizeof(float),
+                mappedLUTBuffer);
+            mColorLUTBuffer->UnmapBuffer();
+        }
+    }
+
+    // Overlays set again with the same layer sizes are rewritten into this buffer, without rebuilding the pipeline
+    Result overlayBufferResult = Result::Success;
+    if (useOverlays) {
+        auto [bufferResult, overlayBuffer] = mDevice->CreateBuffer(
+            mOverlayWords.size() * sizeof(uint32_t),
+            vk::BufferUsageFlagBits::eStorageBuffer,
+            VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT);
+        overlayBufferResult = bufferResult;
+        mOverlayBuffer = overlayBuffer;
+        if (overlayBufferResult == Result::Success) {
+            uint8_t* mappedOverlayBuffer = mOverlayBuffer->MapBuffer();
+            std::copy_n(
+                reinterpret_cast<const uint8_t*>(mOverlayWords.data()),
+                mOverlayWords.size() * sizeof(uint32_t),
+                mappedOverlayBuffer);
+            mOverlayBuffer->UnmapBuffer();
+        }
+    }
+
+    // Statistics are accumulated with atomics by every pass and read straight from this buffer after the fence
+    Result statisticsBufferResult = Result::Success;
+    if (mConfig.collectStatistics) {
+        auto [bufferResult, statisticsBuffer] = mDevice->CreateBuffer(
+            sStatisticsWordCount * sizeof(uint32_t),
+            vk::BufferUsageFlagBits::eStorageBuffer | vk::BufferUsageFlagBits::eTransferDst,
+            VMA_ALLOCATION_CREATE_HOST_ACCESS_RANDOM_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT);
+        statisticsBufferResult = bufferResult;
+        mStatisticsBuffer = statisticsBuffer;
+    }
+
+    // One hash per destination tile, summed like the statistics
+    Result tileHashBufferResult = Result::Success;
+    if (mConfig.detectChanges) {
+        const uint32_t tileCountX = (dst.width + ChangeDetectionTileSize - 1) / ChangeDetectionTileSize;
+        const uint32_t tileCountY = (dst.height + ChangeDetectionTileSize - 1) / ChangeDetectionTileSize;
+        auto [bufferResult, tileHashBuffer] = mDevice->CreateBuffer(
+            tileCountX * tileCountY * sizeof(uint32_t),
+            vk::BufferUsageFlagBits::eStorageBuffer | vk::BufferUsageFlagBits::eTransferDst,
+            VMA_ALLOCATION_CREATE_HOST_ACCESS_RANDOM_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT);
+        tileHashBufferResult = bufferResult;
+        mTileHashBuffer = tileHashBuffer;
+        mFrameChanges.tileCountX = tileCountX;
+        mFrameChanges.tileCountY = tileCountY;
+    }
+
+    // Every source gets its own buffers, images and scaler tables
+    mPasses.resize(passFrames.size());
+    Result passesResult = Result::Success;
+    for (size_t passIndex = 0; passIndex < passFrames.size() && passesResult == Result::Success; ++passIndex) {
+        passesResult = InitPassResources(passFrames[passIndex].src, passFrames[passIndex].dst, mPasses[passIndex]);
+    }
+
+    if (!(dstLocalBufferResult == Result::Success && dstDeviceBufferResult == Result::Success &&
+          colorLUTBufferResult == Result::Success && overlayBufferResult == Result::Success &&
+          statisticsBufferResult == Result::Success && tileHashBufferResult == Result::Success &&
+          passesResult == Result::Success)) {
         CleanUp();
         return Result::AllocationFailed;
     }
 
-    // Create compute pipeline and bindings
-    const auto [pipelineResult, pipelineResources] =
-        mDevice->CreateVideoConversionPipeline(src, mSrcDeviceBuffer, dst, mDstDeviceBuffer);
-    if (pipelineResult != Result::Success) {
-        CleanUp();
-        return Result::ShaderCompilationFailed;
+    // Create compute pipelines and bindings. The first pass writes the whole destination, filling the area outside
+    // its placement, and the following ones only their own placement.
+    for (size_t passIndex = 0; passIndex < mPasses.size(); ++passIndex) {
+        ConversionPass& pass = mPasses[passIndex];
+        VulkanDevice::VideoConversionPipelineBindings bindings;
+        bindings.srcBuffer = pass.srcImagePlanes.empty() ? pass.srcDeviceBuffer : pass.srcLocalBuffer;
+        bindings.dstBuffer = mDstDeviceBuffer;
+        bindings.srcImages.assign(pass.srcImages.begin(), pass.srcImages.end());
+        bindings.scalerWeightBuffer = pass.scalerWeightBuffer;
+        bindings.scalerIntermediateBuffer = pass.scalerIntermediateBuffer;
+        bindings.sampleLUTBuffer = pass.sampleLUTBuffer;
+        bindings.colorLUTBuffer = mColorLUTBuffer;
+        bindings.overlayBuffer = mOverlayBuffer;
+        bindings.statisticsBuffer = mStatisticsBuffer;
+        bindings.tileHashBuffer = mTileHashBuffer;
+        const bool writesPlacementOnly = passIndex > 0;
+        const auto [pipelineResult, pipelineResources] = mDevice->CreateVideoConversionPipeline(
+            passFrames[passIndex].src,
+            passFrames[passIndex].dst,
+            bindings,
+            mConfig,
+            writesPlacementOnly);
+        if (pipelineResult != Result::Success) {
+            CleanUp();
+            return Result::ShaderCompilationFailed;
+        }
+        pass.pipelineResources = pipelineResources;
     }
-    mPipelineResources = pipelineResources;
     mCommand = mDevice->CreateCommandBuffer();
 
     // Record command buffer
@@ -158,61 +700,71 @@ Result VulkanVideoConverter::InitResources(const VideoFrameWrapper& src, VideoFr
             mTimestampQueryPool = mDevice->CreateTimestampQueryPool(sTimemestampQueryCount);
         }
 
-        // Copy local memory into VRAM and add barrier for next stage
-        {
-            if (mEnableBenchmark) {
-                mCommand.writeTimestamp(
-                    vk::PipelineStageFlagBits::eTopOfPipe,
-                    mTimestampQueryPool,
-                    sTimestampStartIndex);
+        // Copy local memory into VRAM for every source, with barriers for the next stage
+        if (mEnableBenchmark) {
+            mCommand.writeTimestamp(vk::PipelineStageFlagBits::eTopOfPipe, mTimestampQueryPool, sTimestampStartIndex);
+        }
+        for (const ConversionPass& pass : mPasses) {
+            RecordSourceUpload(pass);
+        }
+        if (mEnableBenchmark) {
+            mCommand.writeTimestamp(
+                vk::PipelineStageFlagBits::eBottomOfPipe,
+                mTimestampQueryPool,
+                sTimestampSrcTransferDoneIndex);
+        }
+
+        // Statistics and tile hashes start from zero sums and counts, and statistics from the highest possible
+        // minimums
+        std::vector<vk::BufferMemoryBarrier> resetBarriers;
+        for (VulkanBuffer* buffer : {mStatisticsBuffer, mTileHashBuffer}) {
+            if (buffer != nullptr) {
+                mCommand.fillBuffer(buffer->GetBufferHandle(), 0, buffer->GetBufferSize(), 0);
+                resetBarriers.push_back(
+                    vk::BufferMemoryBarrier()
+                        .setSrcAccessMask(vk::AccessFlagBits::eTransferWrite)
+                        .setDstAccessMask(vk::AccessFlagBits::eShaderRead | vk::AccessFlagBits::eShaderWrite)
+                        .setBuffer(buffer->GetBufferHandle())
+                        .setOffset(0)
+                        .setSize(buffer->GetBufferSize()));
             }
-            mCommand.copyBuffer(
-                mSrcLocalBuffer->GetBufferHandle(),
-                mSrcDeviceBuffer->GetBufferHandle(),
-                vk::BufferCopy().setSize(mSrcLocalBuffer->GetBufferSize()).setDstOffset(0).setSrcOffset(0));
-            const vk::BufferMemoryBarrier bufferBarrier = vk::BufferMemoryBarrier()
-                                                              .setSrcAccessMask(vk::AccessFlagBits::eTransferWrite)
-                                                              .setBuffer(mSrcDeviceBuffer->GetBufferHandle())
-                                                              .setOffset(0)
-                                                              .setSize(mSrcDeviceBuffer->GetBufferSize());
+        }
+        if (mStatisticsBuffer != nullptr) {
+            mCommand.fillBuffer(
+                mStatisticsBuffer->GetBufferHandle(),
+                sStatisticsMinSamplesOffset * sizeof(uint32_t),
+                (sStatisticsMaxSamplesOffset - sStatisticsMinSamplesOffset) * sizeof(uint32_t),
+                0xFFFFFFFF);
+        }
+        if (!resetBarriers.empty()) {
             mCommand.pipelineBarrier(
                 vk::PipelineStageFlagBits::eTransfer,
                 vk::PipelineStageFlagBits::eComputeShader,
                 vk::DependencyFlags{},
                 {},
-                bufferBarrier,
+                resetBarriers,
                 {});
-            if (mEnableBenchmark) {
-                mCommand.writeTimestamp(
-                    vk::PipelineStageFlagBits::eBottomOfPipe,
-                    mTimestampQueryPool,
-                    sTimestampSrcTransferDoneIndex);
-            }
         }
 
-        // Bind compute shader resources
-        mCommand.bindPipeline(vk::PipelineBindPoint::eCompute, mPipelineResources.pipeline);
-        mCommand.bindDescriptorSets(
-            vk::PipelineBindPoint::eCompute,
-            mPipelineResources.pipelineLayout,
-            0,
-            mPipelineResources.descriptorSet,
-            {});
-
-        constexpr uint32_t blockSizeX = 2;
-        constexpr uint32_t blockSizeY = 2;
-
-        constexpr uint32_t dispatchSizeX = 16;
-        constexpr uint32_t dispatchSizeY = 16;
-
-        const uint32_t blockCountX = ((dst.width + (blockSizeX - 1)) / blockSizeX);
-        const uint32_t blockCountY = ((dst.height + (blockSizeY - 1)) / blockSizeY);
-
-        // Add additional execution blocks if dimensions aren't divisible by dispatchSize. The shader will handle
-        // graceful reading/writing for now.
-        const uint32_t groupCountX = (blockCountX / dispatchSizeX) + (dispatchSizeX - (blockCountX % dispatchSizeX));
-        const uint32_t groupCountY = (blockCountY / dispatchSizeY) + (dispatchSizeY - (blockCountY % dispatchSizeY));
-        mCommand.dispatch(groupCountX, groupCountY, 1);
+        // Placements of the following passes don't overlap, so only the first pass has to finish before them
+        for (size_t passIndex = 0; passIndex < mPasses.size(); ++passIndex) {
+            RecordConversion(passFrames[passIndex].src, passFrames[passIndex].dst, mPasses[passIndex], passIndex > 0);
+            if (passIndex == 0 && mPasses.size() > 1) {
+                const vk::BufferMemoryBarrier bufferBarrier = vk::BufferMemoryBarrier()
+                                                                  .setSrcAccessMask(vk::AccessFlagBits::eShaderWrite)
+                                                                  .setDstAccessMask(vk::AccessFlagBits::eShaderWrite)
+                                                                  .setBuffer(mDstDeviceBuffer->GetBufferHandle())
+                                                                  .setOffset(0)
+                                                                  .setSize(mDstDeviceBuffer->GetBufferSize());
+                mCommand.pipelineBarrier(
+                    vk::PipelineStageFlagBits::eComputeShader,
+                    vk::PipelineStageFlagBits::eComputeShader,
+                    vk::DependencyFlags{},
+                    {},
+                    bufferBarrier,
+                    {});
+            }
+        }
 
         if (mEnableBenchmark) {
             mCommand.writeTimestamp(
@@ -240,6 +792,26 @@ Result VulkanVideoConverter::InitResources(const VideoFrameWrapper& src, VideoFr
                 mDstDeviceBuffer->GetBufferHandle(),
                 mDstLocalBuffer->GetBufferHandle(),
                 vk::BufferCopy().setSize(mDstDeviceBuffer->GetBufferSize()).setDstOffset(0).setSrcOffset(0));
+            std::vector<vk::BufferMemoryBarrier> hostReadBarriers;
+            for (VulkanBuffer* buffer : {mStatisticsBuffer, mTileHashBuffer}) {
+                if (buffer != nullptr) {
+                    hostReadBarriers.push_back(vk::BufferMemoryBarrier()
+                                                   .setSrcAccessMask(vk::AccessFlagBits::eShaderWrite)
+                                                   .setDstAccessMask(vk::AccessFlagBits::eHostRead)
+                                                   .setBuffer(buffer->GetBufferHandle())
+                                                   .setOffset(0)
+                                                   .setSize(buffer->GetBufferSize()));
+                }
+            }
+            if (!hostReadBarriers.empty()) {
+                mCommand.pipelineBarrier(
+                    vk::PipelineStageFlagBits::eComputeShader,
+                    vk::PipelineStageFlagBits::eHost,
+                    vk::DependencyFlags{},
+                    {},
+                    hostReadBarriers,
+                    {});
+            }
             if (mEnableBenchmark) {
                 mCommand.writeTimestamp(
                     vk::PipelineStageFlagBits::eBottomOfPipe,
@@ -253,6 +825,132 @@ Result VulkanVideoConverter::InitResources(const VideoFrameWrapper& src, VideoFr
     return Result::Success;
 }
 
+void VulkanVideoConverter::RecordSourceUpload(const ConversionPass& pass)
+{
+    if (!pass.srcImagePlanes.empty()) {
+        const vk::ImageSubresourceRange subresourceRange(vk::ImageAspectFlagBits::eColor, 0, 1, 0, 1);
+        std::vector<vk::ImageMemoryBarrier> transferBarriers;
+        std::vector<vk::ImageMemoryBarrier> sampleBarriers;
+        for (const VulkanImage* srcImage : pass.srcImages) {
+            transferBarriers.push_back(vk::ImageMemoryBarrier()
+                                           .setDstAccessMask(vk::AccessFlagBits::eTransferWrite)
+                                           .setOldLayout(vk::ImageLayout::eUndefined)
+                                           .setNewLayout(vk::ImageLayout::eTransferDstOptimal)
+                                           .setImage(srcImage->GetImageHandle())
+                                           .setSubresourceRange(subresourceRange));
+            sampleBarriers.push_back(vk::ImageMemoryBarrier()
+                                         .setSrcAccessMask(vk::AccessFlagBits::eTransferWrite)
+                                         .setDstAccessMask(vk::AccessFlagBits::eShaderRead)
+                                         .setOldLayout(vk::ImageLayout::eTransferDstOptimal)
+                                         .setNewLayout(vk::ImageLayout::eShaderReadOnlyOptimal)
+                                         .setImage(srcImage->GetImageHandle())
+                                         .setSubresourceRange(subresourceRange));
+        }
+        mCommand.pipelineBarrier(
+            vk::PipelineStageFlagBits::eTopOfPipe,
+            vk::PipelineStageFlagBits::eTransfer,
+            vk::DependencyFlags{},
+            {},
+            {},
+            transferBarriers);
+        for (size_t planeIndex = 0; planeIndex < pass.srcImagePlanes.size(); ++planeIndex) {
+            const SampledImagePlane& plane = pass.srcImagePlanes[planeIndex];
+            const vk::BufferImageCopy imageCopy =
+                vk::BufferImageCopy()
+                    .setBufferOffset(plane.bufferOffset)
+                    .setBufferRowLength(plane.bufferRowPitch / plane.texelSize)
+                    .setImageSubresource(vk::ImageSubresourceLayers(vk::ImageAspectFlagBits::eColor, 0, 0, 1))
+                    .setImageExtent(vk::Extent3D(plane.extent, 1));
+            mCommand.copyBufferToImage(
+                pass.srcLocalBuffer->GetBufferHandle(),
+                pass.srcImages[planeIndex]->GetImageHandle(),
+                vk::ImageLayout::eTransferDstOptimal,
+                imageCopy);
+        }
+        mCommand.pipelineBarrier(
+            vk::PipelineStageFlagBits::eTransfer,
+            vk::PipelineStageFlagBits::eComputeShader,
+            vk::DependencyFlags{},
+            {},
+            {},
+            sampleBarriers);
+    } else {
+        mCommand.copyBuffer(
+            pass.srcLocalBuffer->GetBufferHandle(),
+            pass.srcDeviceBuffer->GetBufferHandle(),
+            vk::BufferCopy().setSize(pass.srcLocalBuffer->GetBufferSize()).setDstOffset(0).setSrcOffset(0));
+        const vk::BufferMemoryBarrier bufferBarrier = vk::BufferMemoryBarrier()
+                                                          .setSrcAccessMask(vk::AccessFlagBits::eTransferWrite)
+                                                          .setDstAccessMask(vk::AccessFlagBits::eShaderRead)
+                                                          .setBuffer(pass.srcDeviceBuffer->GetBufferHandle())
+                                                          .setOffset(0)
+                                                          .setSize(pass.srcDeviceBuffer->GetBufferSize());
+        mCommand.pipelineBarrier(
+            vk::PipelineStageFlagBits::eTransfer,
+            vk::PipelineStageFlagBits::eComputeShader,
+            vk::DependencyFlags{},
+            {},
+            bufferBarrier,
+            {});
+    }
+}
+
+void VulkanVideoConverter::RecordConversion(
+    const VideoFrameWrapper& src,
+    const VideoFrameWrapper& dst,
+    const ConversionPass& pass,
+    const bool writesPlacementOnly)
+{
+    const VulkanDevice::VideoConversionPipelineResources& pipelineResources = pass.pipelineResources;
+
+    // Bind compute shader resources, shared by the scaler and conversion pipelines
+    mCommand.bindDescriptorSets(
+        vk::PipelineBindPoint::eCompute,
+        pipelineResources.pipelineLayout,
+        0,
+        pipelineResources.descriptorSet,
+        {});
+
+    // Filter source rows horizontally, one invocation per scaled column and source row
+    if (pass.scalerIntermediateBuffer != nullptr) {
+        mCommand.bindPipeline(vk::PipelineBindPoint::eCompute, pipelineResources.horizontalScalerPipeline);
+        constexpr uint32_t workgroupSize = 16;
+        mCommand.dispatch(
+            (GetScaledSize(src, dst).width + workgroupSize - 1) / workgroupSize,
+            (src.height + workgroupSize - 1) / workgroupSize,
+            1);
+
+        const vk::BufferMemoryBarrier bufferBarrier = vk::BufferMemoryBarrier()
+                                                          .setSrcAccessMask(vk::AccessFlagBits::eShaderWrite)
+                                                          .setDstAccessMask(vk::AccessFlagBits::eShaderRead)
+                                                          .setBuffer(pass.scalerIntermediateBuffer->GetBufferHandle())
+                                                          .setOffset(0)
+                                                          .setSize(pass.scalerIntermediateBuffer->GetBufferSize());
+        mCommand.pipelineBarrier(
+            vk::PipelineStageFlagBits::eComputeShader,
+            vk::PipelineStageFlagBits::eComputeShader,
+            vk::DependencyFlags{},
+            {},
+            bufferBarrier,
+            {});
+    }
+
+    mCommand.bindPipeline(vk::PipelineBindPoint::eCompute, pipelineResources.pipeline);
+
+    // Round up if dimensions aren't divisible by the workgroup extent, the shader skips out of bounds writes. Passes
+    // writing their placement only are dispatched over it.
+    const vk::Extent2D& workgroupPixelExtent = pipelineResources.workgroupPixelExtent;
+    const vk::Extent2D dispatchExtent = writesPlacementOnly
+                                            ? vk::Extent2D(
+                                                  static_cast<uint32_t>(dst.GetPlacementRect().width),
+                                                  static_cast<uint32_t>(dst.GetPlacementRect().height))
+                                            : vk::Extent2D(dst.width, dst.height);
+    const uint32_t groupCountX = (dispatchExtent.width + workgroupPixelExtent.width - 1) / workgroupPixelExtent.width;
+    const uint32_t groupCountY =
+        (dispatchExtent.height + workgroupPixelExtent.height - 1) / workgroupPixelExtent.height;
+    mCommand.dispatch(groupCountX, groupCountY, 1);
+}
+
 void VulkanVideoConverter::CleanUp()
 {
     if (mDevice != nullptr) {
@@ -260,15 +958,22 @@ void VulkanVideoConverter::CleanUp()
         if (mEnableBenchmark) {
             mDevice->DestroyQueryPool(mTimestampQueryPool);
         }
-        mDevice->DestroyVideoConversionPipeline(mPipelineResources);
-        if (mSrcLocalBuffer != nullptr) {
-            mSrcLocalBuffer->Release();
-            mSrcLocalBuffer = nullptr;
-        }
-        if (mSrcDeviceBuffer != nullptr) {
-            mSrcDeviceBuffer->Release();
-            mSrcDeviceBuffer = nullptr;
+        for (ConversionPass& pass : mPasses) {
+            mDevice->DestroyVideoConversionPipeline(pass.pipelineResources);
+            for (VulkanBuffer* buffer : {pass.srcLocalBuffer,
+                                         pass.srcDeviceBuffer,
+                                         pass.scalerWeightBuffer,
+                                         pass.scalerIntermediateBuffer,
+                                         pass.sampleLUTBuffer}) {
+                if (buffer != nullptr) {
+                    buffer->Release();
+                }
+            }
+            for (VulkanImage* srcImage : pass.srcImages) {
+                srcImage->Release();
+            }
         }
+        mPasses.clear();
         if (mDstDeviceBuffer != nullptr) {
             mDstDeviceBuffer->Release();
             mDstDeviceBuffer = nullptr;
@@ -277,14 +982,30 @@ void VulkanVideoConverter::CleanUp()
             mDstLocalBuffer->Release();
             mDstLocalBuffer = nullptr;
         }
+        if (mColorLUTBuffer != nullptr) {
+            mColorLUTBuffer->Release();
+            mColorLUTBuffer = nullptr;
+        }
+        if (mOverlayBuffer != nullptr) {
+            mOverlayBuffer->Release();
+            mOverlayBuffer = nullptr;
+        }
+        if (mStatisticsBuffer != nullptr) {
+            mStatisticsBuffer->Release();
+            mStatisticsBuffer = nullptr;
+        }
+        if (mTileHashBuffer != nullptr) {
+            mTileHashBuffer->Release();
+            mTileHashBuffer = nullptr;
+        }
     }
-    mPrevSourceFrame = std::optional<VideoFrameWrapper>();
-    mPrevDstFrame = std::optional<VideoFrameWrapper>();
+    mPrevPassFrames.clear();
+    mPrevTileHashes.clear();
 }
 
 Result VulkanVideoConverter::Convert(const VideoFrameWrapper& src, VideoFrameWrapper& dst)
 {
-    ResultValue<BenchmarkResult> withBenchmarkResult = ConvertInternal(src, dst, false);
+    ResultValue<BenchmarkResult> withBenchmarkResult = ConvertInternal({{src, dst}}, dst, false);
     return withBenchmarkResult.result;
 }
 
@@ -292,11 +1013,147 @@ ResultValue<BenchmarkResult> VulkanVideoConverter::ConvertWithBenchmark(
     const VideoFrameWrapper& src,
     VideoFrameWrapper& dst)
 {
-    return ConvertInternal(src, dst, true);
+    return ConvertInternal({{src, dst}}, dst, true);
+}
+
+Result VulkanVideoConverter::Compose(const std::vector<VideoTile>& tiles, VideoFrameWrapper& dst)
+{
+    const Result validationResult = ValidateTiles(tiles, dst);
+    if (validationResult != Result::Success) {
+        return validationResult;
+    }
+
+    // Each tile is a pass converting its frame into the destination placed at the tile
+    std::vector<PassFrames> passFrames;
+    for (const VideoTile& tile : tiles) {
+        PassFrames frames{tile.frame, dst};
+        frames.dst.placementRect = tile.rect;
+        passFrames.push_back(frames);
+    }
+    ResultValue<BenchmarkResult> withBenchmarkResult = ConvertInternal(passFrames, dst, false);
+    return withBenchmarkResult.result;
+}
+
+ResultValue<std::vector<uint32_t>> VulkanVideoConverter::PackOverlays(const std::vector<VideoOverlay>& overlays)
+{
+    constexpr uint32_t layerWordCount = 6;
+    size_t wordCount = overlays.empty() ? 0 : 1 + overlays.size() * layerWordCount;
+    for (const VideoOverlay& overlay : overlays) {
+        const uint32_t stride = overlay.stride == 0 ? overlay.width * 4 : overlay.stride;
+        if (overlay.buffer == nullptr || overlay.width == 0 || overlay.height == 0 || stride < overlay.width * 4 ||
+            !(overlay.alpha >= 0.0f && overlay.alpha <= 1.0f)) {
+            return {Result::InvalidOverlayError, {}};
+        }
+        wordCount += static_cast<size_t>(overlay.width) * overlay.height;
+    }
+
+    std::vector<uint32_t> words(wordCount);
+    if (overlays.empty()) {
+        return {Result::Success, words};
+    }
+    words[0] = static_cast<uint32_t>(overlays.size());
+    size_t pixelOffset = 1 + overlays.size() * layerWordCount;
+    for (size_t layerIndex = 0; layerIndex < overlays.size(); ++layerIndex) {
+        const VideoOverlay& overlay = overlays[layerIndex];
+        uint32_t* layerWords = words.data() + 1 + layerIndex * layerWordCount;
+        layerWords[0] = static_cast<uint32_t>(overlay.x);
+        layerWords[1] = static_cast<uint32_t>(overlay.y);
+        layerWords[2] = overlay.width;
+        layerWords[3] = overlay.height;
+        std::memcpy(&layerWords[4], &overlay.alpha, sizeof(float));
+        layerWords[5] = static_cast<uint32_t>(pixelOffset);
+
+        // RGBA bytes read as one little endian word per pixel, unpacked to RGBA by the shader
+        const uint32_t stride = overlay.stride == 0 ? overlay.width * 4 : overlay.stride;
+        for (uint32_t y = 0; y < overlay.height; ++y) {
+            const uint8_t* row = overlay.buffer + static_cast<size_t>(y) * stride;
+            for (uint32_t x = 0; x < overlay.width; ++x) {
+                const uint8_t* pixel = row + x * 4;
+                uint32_t word = 0;
+                for (uint32_t channel = 0; channel < 4; ++channel) {
+                    word |= static_cast<uint32_t>(pixel[channel]) << (channel * 8);
+                }
+                words[pixelOffset++] = word;
+            }
+        }
+    }
+    return {Result::Success, words};
+}
+
+Result VulkanVideoConverter::SetOverlays(const std::vector<VideoOverlay>& overlays)
+{
+    auto [packResult, overlayWords] = PackOverlays(overlays);
+    if (packResult != Result::Success) {
+        return packResult;
+    }
+
+    // Overlays with the same layer sizes go straight into the current buffer, anything else rebuilds the resources on
+    // the next conversion
+    if (mOverlayBuffer != nullptr && overlayWords.size() == mOverlayWords.size()) {
+        uint8_t* mappedOverlayBuffer = mOverlayBuffer->MapBuffer();
+        std::copy_n(
+            reinterpret_cast<const uint8_t*>(overlayWords.data()),
+            overlayWords.size() * sizeof(uint32_t),
+            mappedOverlayBuffer);
+        mOverlayBuffer->UnmapBuffer();
+    } else if (!overlayWords.empty() || !mOverlayWords.empty()) {
+        CleanUp();
+    }
+    mOverlayWords = std::move(overlayWords);
+    // Overlays may cover the fill, which isn't hashed, so the next frame reports every tile
+    mPrevTileHashes.clear();
+    return Result::Success;
+}
+
+FrameStatistics VulkanVideoConverter::GetFrameStatistics() const
+{
+    return mFrameStatistics;
+}
+
+FrameStatistics VulkanVideoConverter::UnpackStatistics(const uint32_t* words)
+{
+    FrameStatistics statistics;
+    std::copy_n(
+        words + sStatisticsLumaHistogramOffset,
+        statistics.lumaHistogram.size(),
+        statistics.lumaHistogram.begin());
+    const uint32_t pixelCount = words[sStatisticsPixelCountOffset];
+    for (size_t channel = 0; channel < 3; ++channel) {
+        // Frames without converted pixels keep the initial minimums, reported as zero like the other channels
+        statistics.minSamples[channel] = pixelCount == 0 ? 0 : words[sStatisticsMinSamplesOffset + channel];
+        statistics.maxSamples[channel] = words[sStatisticsMaxSamplesOffset + channel];
+        const uint32_t* sampleSumWords = words + sStatisticsSampleSumsOffset + channel * 2;
+        const uint64_t sampleSum =
+            static_cast<uint64_t>(sampleSumWords[0]) | (static_cast<uint64_t>(sampleSumWords[1]) << 32);
+        statistics.meanSamples[channel] = pixelCount == 0 ? 0.0 : static_cast<double>(sampleSum) / pixelCount;
+    }
+    statistics.belowRangeSampleCount = words[sStatisticsBelowRangeCountOffset];
+    statistics.aboveRangeSampleCount = words[sStatisticsAboveRangeCountOffset];
+    statistics.pixelCount = pixelCount;
+    return statistics;
+}
+
+FrameChanges VulkanVideoConverter::GetFrameChanges() const
+{
+    return mFrameChanges;
+}
+
+void VulkanVideoConverter::UpdateFrameChanges(const uint32_t* tileHashes)
+{
+    const size_t tileCount = static_cast<size_t>(mFrameChanges.tileCountX) * mFrameChanges.tileCountY;
+    mFrameChanges.changedTileMask.assign((tileCount + 7) / 8, 0);
+    mFrameChanges.isFrameChanged = false;
+    for (size_t tileIndex = 0; tileIndex < tileCount; ++tileIndex) {
+        if (mPrevTileHashes.empty() || tileHashes[tileIndex] != mPrevTileHashes[tileIndex]) {
+            mFrameChanges.changedTileMask[tileIndex / 8] |= static_cast<uint8_t>(1 << (tileIndex % 8));
+            mFrameChanges.isFrameChanged = true;
+        }
+    }
+    mPrevTileHashes.assign(tileHashes, tileHashes + tileCount);
 }
 
 ResultValue<BenchmarkResult> VulkanVideoConverter::ConvertInternal(
-    const VideoFrameWrapper& src,
+    const std::vector<PassFrames>& passFrames,
     VideoFrameWrapper& dst,
     const bool enableBenchmark)
 {
@@ -304,36 +1161,52 @@ ResultValue<BenchmarkResult> VulkanVideoConverter::ConvertInternal(
     mEnableBenchmark = enableBenchmark && mDevice->SupportsTimestamps();
 
     // Validate input, return nothing on failure
-    const Result validationResult = ValidateInput(src, dst);
-    if (validationResult != Result::Success) {
-        return ResultValue<BenchmarkResult>{validationResult, {}};
+    for (const PassFrames& frames : passFrames) {
+        const Result validationResult = ValidateInput(frames.src, frames.dst);
+        if (validationResult != Result::Success) {
+            return ResultValue<BenchmarkResult>{validationResult, {}};
+        }
     }
 
     // Initialize resources and cache shaders, buffers, etc
-    const bool wasInitialized = mPrevSourceFrame.has_value() && mPrevDstFrame.has_value();
-    if (!wasInitialized || !src.AreFramePropertiesEqual(mPrevSourceFrame.value()) ||
-        !dst.AreFramePropertiesEqual(mPrevDstFrame.value())) {
+    const bool wasInitialized = !mPrevPassFrames.empty();
+    const bool arePassFramesEqual =
+        passFrames.size() == mPrevPassFrames.size() &&
+        std::equal(
+            passFrames.begin(),
+            passFrames.end(),
+            mPrevPassFrames.begin(),
+            [](const PassFrames& frames, const PassFrames& prevFrames) {
+                return frames.src.AreFramePropertiesEqual(prevFrames.src) &&
+                       frames.dst.AreFramePropertiesEqual(prevFrames.dst);
+            });
+    if (!wasInitialized || !arePassFramesEqual) {
         if (wasInitialized) {
             CleanUp();
         }
-        Result initResult = InitResources(src, dst);
+        Result initResult = InitResources(passFrames);
         if (initResult == Result::Success) {
-            mPrevSourceFrame = src;
-            mPrevDstFrame = dst;
+            mPrevPassFrames = passFrames;
         } else {
             CleanUp();
             return {initResult, {}};
         }
     }
 
-    // Copy src buffer into GPU readable buffer
+    // Copy src buffers into GPU readable buffers
     BenchmarkResult benchmarkResult;
+    benchmarkResult.usedSampledImages = std::any_of(mPasses.begin(), mPasses.end(), [](const ConversionPass& pass) {
+        return !pass.srcImagePlanes.empty();
+    });
     Timer cpuTimer;
     cpuTimer.Start();
-    const vk::DeviceSize srcBufferSize = src.GetBufferSize();
-    uint8_t* mappedSrcBuffer = mSrcLocalBuffer->MapBuffer();
-    std::copy_n(src.buffer, srcBufferSize, mappedSrcBuffer);
-    mSrcLocalBuffer->UnmapBuffer();
+    for (size_t passIndex = 0; passIndex < passFrames.size(); ++passIndex) {
+        const VideoFrameWrapper& src = passFrames[passIndex].src;
+        VulkanBuffer* srcLocalBuffer = mPasses[passIndex].srcLocalBuffer;
+        uint8_t* mappedSrcBuffer = srcLocalBuffer->MapBuffer();
+        std::copy_n(src.buffer, src.GetBufferSize(), mappedSrcBuffer);
+        srcLocalBuffer->UnmapBuffer();
+    }
     benchmarkResult.copyToDeviceVisibleTimeMicros = cpuTimer.ElapsedMicros();
 
     // Dispatch command in compute queue
@@ -353,13 +1226,32 @@ ResultValue<BenchmarkResult> VulkanVideoConverter::ConvertInternal(
 
     benchmarkResult.gpuConversionTimeMicros = cpuTimer.ElapsedMicros();
 
-    // Copy contents into CPU buffer
-    cpuTimer.Start();
+    if (mTileHashBuffer != nullptr) {
+        const uint8_t* mappedTileHashBuffer = mTileHashBuffer->MapBuffer();
+        UpdateFrameChanges(reinterpret_cast<const uint32_t*>(mappedTileHashBuffer));
+        mTileHashBuffer->UnmapBuffer();
+    }
+
+    // Copy contents into CPU buffer, unless the destination is the buffer the unchanged frame was last copied into
     const vk::DeviceSize dstBufferSize = dst.GetBufferSize();
-    uint8_t* mappedDstBuffer = mDstLocalBuffer->MapBuffer();
-    std::copy_n(mappedDstBuffer, dstBufferSize, dst.buffer);
-    mDstLocalBuffer->UnmapBuffer();
-    benchmarkResult.copyDeviceVisibleToHostLocalTimeMicros = cpuTimer.ElapsedMicros();
+    const bool holdsUnchangedFrame = mConfig.skipUnchangedFrameReadback && mTileHashBuffer != nullptr &&
+                                     !mFrameChanges.isFrameChanged && dst.buffer == mPrevDstBuffer &&
+                                     dstBufferSize == mPrevDstBufferSize;
+    if (!holdsUnchangedFrame) {
+        cpuTimer.Start();
+        uint8_t* mappedDstBuffer = mDstLocalBuffer->MapBuffer();
+        std::copy_n(mappedDstBuffer, dstBufferSize, dst.buffer);
+        mDstLocalBuffer->UnmapBuffer();
+        mPrevDstBuffer = dst.buffer;
+        mPrevDstBufferSize = dstBufferSize;
+        benchmarkResult.copyDeviceVisibleToHostLocalTimeMicros = cpuTimer.ElapsedMicros();
+    }
+
+    if (mStatisticsBuffer != nullptr) {
+        const uint8_t* mappedStatisticsBuffer = mStatisticsBuffer->MapBuffer();
+        mFrameStatistics = UnpackStatistics(reinterpret_cast<const uint32_t*>(mappedStatisticsBuffer));
+        mStatisticsBuffer->UnmapBuffer();
+    }
 
     return ResultValue<BenchmarkResult>{Result::Success, benchmarkResult};
 }
@@ -1,6 +1,6 @@
 #pragma once
 
-#include <optional>
+#include <vector>
 
 #include "VideoConverter.h"
 #include "VulkanBase.h"
@@ -12,37 +12,119 @@ namespace Pixelweave
 class VulkanVideoConverter : public VideoConverter
 {
 public:
-    VulkanVideoConverter(VulkanDevice* device);
+    VulkanVideoConverter(VulkanDevice* device, const VideoConverterConfig& config);
     ~VulkanVideoConverter() override;
 
     Result Convert(const VideoFrameWrapper& src, VideoFrameWrapper& dst) override;
     ResultValue<BenchmarkResult> ConvertWithBenchmark(const VideoFrameWrapper& src, VideoFrameWrapper& dst) override;
+    Result Compose(const std::vector<VideoTile>& tiles, VideoFrameWrapper& dst) override;
+    Result SetOverlays(const std::vector<VideoOverlay>& overlays) override;
+    FrameStatistics GetFrameStatistics() const override;
+    FrameChanges GetFrameChanges() const override;
 
 private:
+    // Source frame and the destination it is converted into, whose placement is the area the pass writes. Every pass
+    // of a conversion shares the destination buffer.
+    struct PassFrames {
+        VideoFrameWrapper src;
+        VideoFrameWrapper dst;
+    };
+
     ResultValue<BenchmarkResult> ConvertInternal(
-        const VideoFrameWrapper& src,
+        const std::vector<PassFrames>& passFrames,
         VideoFrameWrapper& dst,
         bool enableBenchmark);
 
     static Result ValidateInput(const VideoFrameWrapper& src, const VideoFrameWrapper& dst);
+    static Result ValidateTiles(const std::vector<VideoTile>& tiles, const VideoFrameWrapper& dst);
     static bool IsInputFormatSupported(PixelFormat format);
     static bool IsOutputFormatSupported(PixelFormat format);
 
-    Result InitResources(const VideoFrameWrapper& src, VideoFrameWrapper& dst);
+    // Overlays as read by the shader: the layer count, then the x, y, width, height, alpha bits and pixel word offset
+    // of every layer, then every layer's RGBA pixels. Empty when there are no overlays.
+    static ResultValue<std::vector<uint32_t>> PackOverlays(const std::vector<VideoOverlay>& overlays);
+
+    // Statistics as accumulated by the shader: the 256 histogram bins, the minimum and maximum sample of every channel,
+    // the low and high words of every channel's sample sum, then the below range, above range and pixel counts. Word
+    // offsets must match the `Statistics` buffer in the conversion shader.
+    static constexpr uint32_t sStatisticsLumaHistogramOffset = 0;
+    static constexpr uint32_t sStatisticsMinSamplesOffset = sStatisticsLumaHistogramOffset + 256;
+    static constexpr uint32_t sStatisticsMaxSamplesOffset = sStatisticsMinSamplesOffset + 3;
+    static constexpr uint32_t sStatisticsSampleSumsOffset = sStatisticsMaxSamplesOffset + 3;
+    static constexpr uint32_t sStatisticsBelowRangeCountOffset = sStatisticsSampleSumsOffset + 3 * 2;
+    static constexpr uint32_t sStatisticsAboveRangeCountOffset = sStatisticsBelowRangeCountOffset + 1;
+    static constexpr uint32_t sStatisticsPixelCountOffset = sStatisticsAboveRangeCountOffset + 1;
+    static constexpr uint32_t sStatisticsWordCount = sStatisticsPixelCountOffset + 1;
+    static FrameStatistics UnpackStatistics(const uint32_t* words);
+
+    // Compares tile hashes with the previous frame's, which they replace
+    void UpdateFrameChanges(const uint32_t* tileHashes);
+
+    // Source plane uploaded into an image for the sampled image path
+    struct SampledImagePlane {
+        vk::Format format;
+        vk::Extent2D extent;
+        vk::DeviceSize bufferOffset;
+        uint32_t bufferRowPitch;  // In bytes
+        uint32_t texelSize;       // In bytes
+    };
+    std::vector<SampledImagePlane> GetSampledImagePlanes(const VideoFrameWrapper& src, const VideoFrameWrapper& dst)
+        const;
+
+    // Regions copying every plane row of `src` into `dst` when both frames share format and size, empty otherwise
+    static std::vector<vk::BufferCopy> GetDirectCopyRegions(const VideoFrameWrapper& src, const VideoFrameWrapper& dst);
+
+    // Resources reading one source frame, converted by its own pipeline into the shared destination buffer
+    struct ConversionPass {
+        VulkanBuffer* srcLocalBuffer = nullptr;
+        VulkanBuffer* srcDeviceBuffer = nullptr;
+        std::vector<VulkanImage*> srcImages;
+        std::vector<SampledImagePlane> srcImagePlanes;
+        VulkanBuffer* scalerWeightBuffer = nullptr;
+        VulkanBuffer* scalerIntermediateBuffer = nullptr;
+        VulkanBuffer* sampleLUTBuffer = nullptr;
+        VulkanDevice::VideoConversionPipelineResources pipelineResources;
+    };
+
+    Result InitResources(const std::vector<PassFrames>& passFrames);
+    Result InitPassResources(const VideoFrameWrapper& src, const VideoFrameWrapper& dst, ConversionPass& pass);
+    Result InitDirectCopyResources(
+        const VideoFrameWrapper& src,
+        const VideoFrameWrapper& dst,
+        const std::vector<vk::BufferCopy>& copyRegions);
+    void RecordSourceUpload(const ConversionPass& pass);
+    void RecordConversion(
+        const VideoFrameWrapper& src,
+        const VideoFrameWrapper& dst,
+        const ConversionPass& pass,
+        bool writesPlacementOnly);
     void CleanUp();
 
     VulkanDevice* mDevice;
+    VideoConverterConfig mConfig;
 
-    VulkanBuffer* mSrcLocalBuffer;
-    VulkanBuffer* mSrcDeviceBuffer;
+    std::vector<ConversionPass> mPasses;
 
     VulkanBuffer* mDstLocalBuffer;
     VulkanBuffer* mDstDeviceBuffer;
 
-    VulkanDevice::VideoConversionPipelineResources mPipelineResources;
+    VulkanBuffer* mColorLUTBuffer;
+    VulkanBuffer* mOverlayBuffer;
+    VulkanBuffer* mStatisticsBuffer;
+    VulkanBuffer* mTileHashBuffer;
+
+    std::vector<uint32_t> mOverlayWords;
+    FrameStatistics mFrameStatistics;
+    // Hashes of the previous frame, empty when every tile has to be reported as changed
+    std::vector<uint32_t> mPrevTileHashes;
+    FrameChanges mFrameChanges;
+    // Host buffer the last frame was copied into, an unchanged frame is only left out when copying into it again
+    uint8_t* mPrevDstBuffer;
+    uint64_t mPrevDstBufferSize;
+
     vk::CommandBuffer mCommand;
 
-    std::optional<VideoFrameWrapper> mPrevSourceFrame, mPrevDstFrame;
+    std::vector<PassFrames> mPrevPassFrames;
 
     static const uint32_t sTimestampStartIndex = 0;
     static const uint32_t sTimestampSrcTransferDoneIndex = 1;
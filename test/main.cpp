@@ -1,6 +1,10 @@
 #include <algorithm>
 #include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
 #include <cstring>
+#include <fstream>
 #include <iostream>
 #include <set>
 #include <vector>
@@ -22,6 +26,15 @@ struct Timer {
     std::chrono::steady_clock::time_point beginTime;
 };
 
+float HalfToFloat(uint16_t half)
+{
+    const int exponent = (half >> 10) & 0x1F;
+    const int mantissa = half & 0x3FF;
+    const float magnitude = exponent == 0 ? std::ldexp(static_cast<float>(mantissa), -24)
+                                          : std::ldexp(static_cast<float>(mantissa | 0x400), exponent - 25);
+    return (half & 0x8000) != 0 ? -magnitude : magnitude;
+}
+
 VideoFrameWrapper GetUYVYFrame(uint32_t width, uint32_t height)
 {
     const uint32_t stride = width * 2;
@@ -312,7 +325,29 @@ VideoFrameWrapper GetPlanar44410BitFrame(uint32_t width, uint32_t height)
     };
 }
 
-VideoFrameWrapper Get10BitXRGBBEBuffer(uint32_t width, uint32_t height)
+VideoFrameWrapper GetARGBFrame(uint32_t width, uint32_t height)
+{
+    const uint32_t bufferSize = (height * width) * 4;
+    uint8_t* buffer = new uint8_t[bufferSize];
+    for (uint32_t sampleIndex = 0; sampleIndex < width * height; ++sampleIndex) {
+        buffer[sampleIndex * 4] = 0xFF;
+        buffer[sampleIndex * 4 + 1] = 0xFF;
+        buffer[sampleIndex * 4 + 2] = 0xFF;
+        buffer[sampleIndex * 4 + 3] = 0xFF;
+    }
+    return VideoFrameWrapper{
+        .buffer = buffer,
+        .stride = width * 4,
+        .chromaStride = 0,
+        .width = width,
+        .height = height,
+        .pixelFormat = PixelFormat::RGB8BitInterleavedARGB,
+        .isVideoFullRange = true,
+        .lumaChromaMatrix = LumaChromaMatrix::Identity,
+    };
+}
+
+VideoFrameWrapper Get10BitRGBBuffer(PixelFormat pixelFormat, uint32_t width, uint32_t height)
 {
     const uint32_t bufferSize = width * height;
     uint32_t* buffer = new uint32_t[bufferSize];
@@ -325,7 +360,28 @@ VideoFrameWrapper Get10BitXRGBBEBuffer(uint32_t width, uint32_t height)
         .chromaStride = 0,
         .width = width,
         .height = height,
-        .pixelFormat = PixelFormat::RGB10BitInterleavedXRGBBE,
+        .pixelFormat = pixelFormat,
+        .isVideoFullRange = false,
+        .lumaChromaMatrix = LumaChromaMatrix::Identity,
+    };
+}
+
+VideoFrameWrapper Get12BitBGRBuffer(PixelFormat pixelFormat, uint32_t width, uint32_t height)
+{
+    // Lines hold whole groups of 8 pixels in 36 bytes
+    const uint32_t stride = ((width + 7) / 8) * 36;
+    const uint32_t bufferSize = stride * height;
+    uint8_t* buffer = new uint8_t[bufferSize];
+    for (uint32_t bufferIndex = 0; bufferIndex < bufferSize; ++bufferIndex) {
+        buffer[bufferIndex] = 0;
+    }
+    return VideoFrameWrapper{
+        .buffer = buffer,
+        .stride = stride,
+        .chromaStride = 0,
+        .width = width,
+        .height = height,
+        .pixelFormat = pixelFormat,
         .isVideoFullRange = false,
         .lumaChromaMatrix = LumaChromaMatrix::Identity,
     };
@@ -354,7 +410,7 @@ VideoFrameWrapper GetP216Frame(uint32_t width, uint32_t height)
     return VideoFrameWrapper{
         .buffer = reinterpret_cast<uint8_t*>(buffer),
         .stride = width * 2,
-        .chromaStride = 0,
+        .chromaStride = chromaWidth * 2,
         .width = width,
         .height = height,
         .pixelFormat = PixelFormat::YCC16Bit422BiplanarP216,
@@ -363,6 +419,33 @@ VideoFrameWrapper GetP216Frame(uint32_t width, uint32_t height)
     };
 }
 
+VideoFrameWrapper GetBiplanar10BitFrame(PixelFormat pixelFormat, uint32_t width, uint32_t height)
+{
+    const uint32_t chromaWidth = pixelFormat == PixelFormat::YCC10Bit444BiplanarP410 ? width : (width + 1) / 2;
+    const uint32_t chromaHeight = pixelFormat == PixelFormat::YCC10Bit420BiplanarP010 ? (height + 1) / 2 : height;
+    const uint32_t bufferSize = height * width + chromaWidth * chromaHeight * 2;
+    uint16_t* buffer = new uint16_t[bufferSize];
+    // Samples are stored in the upper 10 bits
+    for (uint32_t ySampleIndex = 0; ySampleIndex < width * height; ++ySampleIndex) {
+        buffer[ySampleIndex] = 0x3AC << 6;
+    }
+    const uint32_t uvSampleOffset = width * height;
+    for (uint32_t uvSampleIndex = 0; uvSampleIndex < chromaWidth * chromaHeight * 2; uvSampleIndex += 2) {
+        buffer[uvSampleOffset + uvSampleIndex] = 0x2C0 << 6;
+        buffer[uvSampleOffset + uvSampleIndex + 1] = 0x300 << 6;
+    }
+    return VideoFrameWrapper{
+        .buffer = reinterpret_cast<uint8_t*>(buffer),
+        .stride = width * 2,
+        .chromaStride = chromaWidth * 2,
+        .width = width,
+        .height = height,
+        .pixelFormat = pixelFormat,
+        .isVideoFullRange = false,
+        .lumaChromaMatrix = LumaChromaMatrix::BT709,
+    };
+}
+
 VideoFrameWrapper GetV210Buffer(uint32_t width, uint32_t height)
 {
     const uint32_t stride = ((width + 47) / 48) * 128;
@@ -383,17 +466,202 @@ VideoFrameWrapper GetV210Buffer(uint32_t width, uint32_t height)
     };
 }
 
+VideoFrameWrapper GetGradient44410BitFrame(uint32_t width, uint32_t height)
+{
+    const uint32_t planeSize = width * height;
+    uint16_t* buffer = new uint16_t[planeSize * 3];
+    for (uint32_t y = 0; y < height; ++y) {
+        for (uint32_t x = 0; x < width; ++x) {
+            const uint32_t sampleIndex = y * width + x;
+            buffer[sampleIndex] = static_cast<uint16_t>((x * 0x3FF) / std::max(width - 1, 1u));
+            buffer[planeSize + sampleIndex] = static_cast<uint16_t>((y * 0x3FF) / std::max(height - 1, 1u));
+            buffer[planeSize * 2 + sampleIndex] =
+                static_cast<uint16_t>(((x + y) * 0x3FF) / std::max(width + height - 2, 1u));
+        }
+    }
+    return VideoFrameWrapper{
+        .buffer = reinterpret_cast<uint8_t*>(buffer),
+        .stride = width * 2,
+        .chromaStride = width * 2,
+        .width = width,
+        .height = height,
+        .pixelFormat = PixelFormat::YCC10Bit444Planar,
+        .isVideoFullRange = false,
+        .lumaChromaMatrix = LumaChromaMatrix::BT709,
+    };
+}
+
+VideoFrameWrapper GetYUY2Frame(uint32_t width, uint32_t height)
+{
+    const uint32_t stride = ((width + 1) / 2) * 4;
+    const uint32_t bufferSize = height * stride;
+    uint8_t* buffer = new uint8_t[bufferSize];
+    for (uint32_t x = 0; x < ((width + 1) / 2); ++x) {
+        for (uint32_t y = 0; y < height; ++y) {
+            const uint32_t baseIndex = y * stride + x * 4;
+            buffer[baseIndex] = 0xFF;      // Y
+            buffer[baseIndex + 1] = 0xB0;  // U
+            buffer[baseIndex + 2] = 0xFF;  // Y
+            buffer[baseIndex + 3] = 0xC0;  // V
+        }
+    }
+    return VideoFrameWrapper{
+        .buffer = buffer,
+        .stride = stride,
+        .chromaStride = 0,
+        .width = width,
+        .height = height,
+        .pixelFormat = PixelFormat::YCC8Bit422InterleavedYUY2,
+        .isVideoFullRange = false,
+        .lumaChromaMatrix = LumaChromaMatrix::BT709,
+    };
+}
+
+VideoFrameWrapper GetY210Frame(uint32_t width, uint32_t height)
+{
+    const uint32_t stride = ((width + 1) / 2) * 8;
+    const uint32_t bufferSize = height * stride / 2;
+    uint16_t* buffer = new uint16_t[bufferSize];
+    for (uint32_t macropixelIndex = 0; macropixelIndex < bufferSize / 4; ++macropixelIndex) {
+        buffer[macropixelIndex * 4] = 0x3AC << 6;      // Y
+        buffer[macropixelIndex * 4 + 1] = 0x2C0 << 6;  // U
+        buffer[macropixelIndex * 4 + 2] = 0x3AC << 6;  // Y
+        buffer[macropixelIndex * 4 + 3] = 0x300 << 6;  // V
+    }
+    return VideoFrameWrapper{
+        .buffer = reinterpret_cast<uint8_t*>(buffer),
+        .stride = stride,
+        .chromaStride = 0,
+        .width = width,
+        .height = height,
+        .pixelFormat = PixelFormat::YCC10Bit422InterleavedY210,
+        .isVideoFullRange = false,
+        .lumaChromaMatrix = LumaChromaMatrix::BT709,
+    };
+}
+
+VideoFrameWrapper GetV410Frame(uint32_t width, uint32_t height)
+{
+    const uint32_t bufferSize = width * height;
+    uint32_t* buffer = new uint32_t[bufferSize];
+    for (uint32_t bufferIndex = 0; bufferIndex < bufferSize; ++bufferIndex) {
+        buffer[bufferIndex] = (0x2C0 << 2) | (0x3AC << 12) | (0x300 << 22);
+    }
+    return VideoFrameWrapper{
+        .buffer = reinterpret_cast<uint8_t*>(buffer),
+        .stride = width * 4,
+        .chromaStride = 0,
+        .width = width,
+        .height = height,
+        .pixelFormat = PixelFormat::YCC10Bit444InterleavedV410,
+        .isVideoFullRange = false,
+        .lumaChromaMatrix = LumaChromaMatrix::BT709,
+    };
+}
+
+VideoFrameWrapper Get24BitRGBFrame(PixelFormat pixelFormat, uint32_t width, uint32_t height)
+{
+    const uint32_t bufferSize = (height * width) * 3;
+    uint8_t* buffer = new uint8_t[bufferSize];
+    for (uint32_t sampleIndex = 0; sampleIndex < width * height; ++sampleIndex) {
+        buffer[sampleIndex * 3] = 0xFF;
+        buffer[sampleIndex * 3 + 1] = 0x80;
+        buffer[sampleIndex * 3 + 2] = 0x00;
+    }
+    return VideoFrameWrapper{
+        .buffer = buffer,
+        .stride = width * 3,
+        .chromaStride = 0,
+        .width = width,
+        .height = height,
+        .pixelFormat = pixelFormat,
+        .isVideoFullRange = true,
+        .lumaChromaMatrix = LumaChromaMatrix::Identity,
+    };
+}
+
+VideoFrameWrapper GetRGB48Frame(uint32_t width, uint32_t height)
+{
+    const uint32_t bufferSize = (height * width) * 3;
+    uint16_t* buffer = new uint16_t[bufferSize];
+    for (uint32_t sampleIndex = 0; sampleIndex < width * height; ++sampleIndex) {
+        buffer[sampleIndex * 3] = 0xFFFF;
+        buffer[sampleIndex * 3 + 1] = 0x8000;
+        buffer[sampleIndex * 3 + 2] = 0x0000;
+    }
+    return VideoFrameWrapper{
+        .buffer = reinterpret_cast<uint8_t*>(buffer),
+        .stride = width * 6,
+        .chromaStride = 0,
+        .width = width,
+        .height = height,
+        .pixelFormat = PixelFormat::RGB16BitInterleavedRGB,
+        .isVideoFullRange = true,
+        .lumaChromaMatrix = LumaChromaMatrix::Identity,
+    };
+}
+
+VideoFrameWrapper GetYUVAFrame(PixelFormat pixelFormat, uint32_t width, uint32_t height)
+{
+    const bool is420 = pixelFormat == PixelFormat::YCCA8Bit420Planar;
+    const uint32_t chromaWidth = is420 ? (width + 1) / 2 : width;
+    const uint32_t chromaHeight = is420 ? (height + 1) / 2 : height;
+    const uint32_t lumaSize = width * height;
+    const uint32_t chromaSize = chromaWidth * chromaHeight;
+    const uint32_t bufferSize = lumaSize * 2 + chromaSize * 2;
+    uint8_t* buffer = new uint8_t[bufferSize];
+    for (uint32_t sampleIndex = 0; sampleIndex < lumaSize; ++sampleIndex) {
+        buffer[sampleIndex] = 0xEB;
+        buffer[lumaSize + chromaSize * 2 + sampleIndex] = static_cast<uint8_t>(sampleIndex % 256);
+    }
+    for (uint32_t sampleIndex = 0; sampleIndex < chromaSize * 2; ++sampleIndex) {
+        buffer[lumaSize + sampleIndex] = 0x80;
+    }
+    return VideoFrameWrapper{
+        .buffer = buffer,
+        .stride = width,
+        .chromaStride = chromaWidth,
+        .width = width,
+        .height = height,
+        .pixelFormat = pixelFormat,
+        .isVideoFullRange = false,
+        .lumaChromaMatrix = LumaChromaMatrix::BT709,
+    };
+}
+
+VideoFrameWrapper GetPlanarRGBFrame(PixelFormat pixelFormat, uint32_t width, uint32_t height)
+{
+    uint32_t sampleSize = 1;
+    if (pixelFormat == PixelFormat::RGB16BitPlanarGBR || pixelFormat == PixelFormat::RGBFloat16PlanarNCHW) {
+        sampleSize = 2;
+    } else if (pixelFormat == PixelFormat::RGBFloat32PlanarNCHW) {
+        sampleSize = 4;
+    }
+    const uint32_t bufferSize = (height * width) * sampleSize * 3;
+    uint8_t* buffer = new uint8_t[bufferSize];
+    std::memset(buffer, 0, bufferSize);
+    return VideoFrameWrapper{
+        .buffer = buffer,
+        .stride = width * sampleSize,
+        .chromaStride = width * sampleSize,
+        .width = width,
+        .height = height,
+        .pixelFormat = pixelFormat,
+        .isVideoFullRange = true,
+        .lumaChromaMatrix = LumaChromaMatrix::Identity,
+    };
+}
+
 VideoFrameWrapper CreateFrame(PixelFormat pixelFormat, uint32_t width, uint32_t height)
 {
-    static_assert(AllPixelFormats.size() == 25);
+    static_assert(AllPixelFormats.size() == 37);
     switch (pixelFormat) {
         case PixelFormat::RGB8BitInterleavedBGRA:
             return GetBGRAFrame(width, height);
         case PixelFormat::RGB8BitInterleavedRGBA:
             return GetRGBAFrame(width, height);
         case PixelFormat::RGB8BitInterleavedARGB:
-            // TODO
-            return VideoFrameWrapper{};
+            return GetARGBFrame(width, height);
         case PixelFormat::YCC8Bit420Planar:
             return GetPlanar420Frame(width, height);
         case PixelFormat::YCC8Bit420PlanarYV12:
@@ -407,22 +675,12 @@ VideoFrameWrapper CreateFrame(PixelFormat pixelFormat, uint32_t width, uint32_t
         case PixelFormat::YCC8Bit422InterleavedUYVY:
             return GetUYVYFrame(width, height);
         case PixelFormat::RGB10BitInterleavedRGBXBE:
-            // TODO
-            return VideoFrameWrapper{};
         case PixelFormat::RGB10BitInterleavedRGBXLE:
-            // TODO
-            return VideoFrameWrapper{};
         case PixelFormat::RGB10BitInterleavedXRGBBE:
-            return Get10BitXRGBBEBuffer(width, height);
         case PixelFormat::RGB10BitInterleavedXRGBLE:
-            // TODO
-            return VideoFrameWrapper{};
         case PixelFormat::RGB10BitInterleavedXBGRBE:
-            // TODO
-            return VideoFrameWrapper{};
         case PixelFormat::RGB10BitInterleavedXBGRLE:
-            // TODO
-            return VideoFrameWrapper{};
+            return Get10BitRGBBuffer(pixelFormat, width, height);
         case PixelFormat::YCC10Bit420Planar:
             return GetPlanar42010BitFrame(width, height);
         case PixelFormat::YCC10Bit422Planar:
@@ -430,24 +688,35 @@ VideoFrameWrapper CreateFrame(PixelFormat pixelFormat, uint32_t width, uint32_t
         case PixelFormat::YCC10Bit444Planar:
             return GetPlanar44410BitFrame(width, height);
         case PixelFormat::YCC10Bit420BiplanarP010:
-            // TODO
-            return VideoFrameWrapper{};
         case PixelFormat::YCC10Bit422BiplanarP210:
-            // TODO
-            return VideoFrameWrapper{};
         case PixelFormat::YCC10Bit444BiplanarP410:
-            // TODO
-            return VideoFrameWrapper{};
+            return GetBiplanar10BitFrame(pixelFormat, width, height);
         case PixelFormat::YCC10Bit422InterleavedV210:
             return GetV210Buffer(width, height);
         case PixelFormat::RGB12BitInterleavedBGRBE:
-            // TODO
-            return VideoFrameWrapper{};
         case PixelFormat::RGB12BitInterleavedBGRLE:
-            // TODO
-            return VideoFrameWrapper{};
+            return Get12BitBGRBuffer(pixelFormat, width, height);
         case PixelFormat::YCC16Bit422BiplanarP216:
             return GetP216Frame(width, height);
+        case PixelFormat::YCC8Bit422InterleavedYUY2:
+            return GetYUY2Frame(width, height);
+        case PixelFormat::YCC10Bit422InterleavedY210:
+            return GetY210Frame(width, height);
+        case PixelFormat::YCC10Bit444InterleavedV410:
+            return GetV410Frame(width, height);
+        case PixelFormat::RGB8BitInterleavedRGB:
+        case PixelFormat::RGB8BitInterleavedBGR:
+            return Get24BitRGBFrame(pixelFormat, width, height);
+        case PixelFormat::RGB16BitInterleavedRGB:
+            return GetRGB48Frame(width, height);
+        case PixelFormat::YCCA8Bit420Planar:
+        case PixelFormat::YCCA8Bit444Planar:
+            return GetYUVAFrame(pixelFormat, width, height);
+        case PixelFormat::RGB8BitPlanarGBR:
+        case PixelFormat::RGB16BitPlanarGBR:
+        case PixelFormat::RGBFloat16PlanarNCHW:
+        case PixelFormat::RGBFloat32PlanarNCHW:
+            return GetPlanarRGBFrame(pixelFormat, width, height);
         default:
             return VideoFrameWrapper{};
     }
@@ -455,7 +724,7 @@ VideoFrameWrapper CreateFrame(PixelFormat pixelFormat, uint32_t width, uint32_t
 
 std::string GetFormatName(PixelFormat pixelFormat)
 {
-    static_assert(AllPixelFormats.size() == 25);
+    static_assert(AllPixelFormats.size() == 37);
     switch (pixelFormat) {
         case PixelFormat::RGB8BitInterleavedBGRA:
             return "RGB8BitInterleavedBGRA";
@@ -507,6 +776,30 @@ std::string GetFormatName(PixelFormat pixelFormat)
             return "RGB12BitInterleavedBGRLE";
         case PixelFormat::YCC16Bit422BiplanarP216:
             return "YCC16Bit422BiplanarP216";
+        case PixelFormat::YCC8Bit422InterleavedYUY2:
+            return "YCC8Bit422InterleavedYUY2";
+        case PixelFormat::YCC10Bit422InterleavedY210:
+            return "YCC10Bit422InterleavedY210";
+        case PixelFormat::YCC10Bit444InterleavedV410:
+            return "YCC10Bit444InterleavedV410";
+        case PixelFormat::RGB8BitInterleavedRGB:
+            return "RGB8BitInterleavedRGB";
+        case PixelFormat::RGB8BitInterleavedBGR:
+            return "RGB8BitInterleavedBGR";
+        case PixelFormat::RGB16BitInterleavedRGB:
+            return "RGB16BitInterleavedRGB";
+        case PixelFormat::YCCA8Bit420Planar:
+            return "YCCA8Bit420Planar";
+        case PixelFormat::YCCA8Bit444Planar:
+            return "YCCA8Bit444Planar";
+        case PixelFormat::RGB8BitPlanarGBR:
+            return "RGB8BitPlanarGBR";
+        case PixelFormat::RGB16BitPlanarGBR:
+            return "RGB16BitPlanarGBR";
+        case PixelFormat::RGBFloat16PlanarNCHW:
+            return "RGBFloat16PlanarNCHW";
+        case PixelFormat::RGBFloat32PlanarNCHW:
+            return "RGBFloat32PlanarNCHW";
         default:
             return "";
     }
@@ -539,29 +832,69 @@ int main()
     std::vector<PixelFormat> validInputFormats{
         PixelFormat::RGB8BitInterleavedBGRA,
         PixelFormat::RGB8BitInterleavedRGBA,
+        PixelFormat::RGB8BitInterleavedARGB,
         PixelFormat::YCC8Bit420Planar,
         PixelFormat::YCC8Bit420PlanarYV12,
         PixelFormat::YCC8Bit422Planar,
         PixelFormat::YCC8Bit444Planar,
         PixelFormat::YCC8Bit420BiplanarNV12,
         PixelFormat::YCC8Bit422InterleavedUYVY,
+        PixelFormat::RGB10BitInterleavedRGBXBE,
+        PixelFormat::RGB10BitInterleavedRGBXLE,
         PixelFormat::RGB10BitInterleavedXRGBBE,
+        PixelFormat::RGB10BitInterleavedXRGBLE,
+        PixelFormat::RGB10BitInterleavedXBGRBE,
+        PixelFormat::RGB10BitInterleavedXBGRLE,
         PixelFormat::YCC10Bit420Planar,
         PixelFormat::YCC10Bit422Planar,
         PixelFormat::YCC10Bit444Planar,
+        PixelFormat::YCC10Bit420BiplanarP010,
+        PixelFormat::YCC10Bit422BiplanarP210,
+        PixelFormat::YCC10Bit444BiplanarP410,
+        PixelFormat::RGB12BitInterleavedBGRBE,
+        PixelFormat::RGB12BitInterleavedBGRLE,
         PixelFormat::YCC16Bit422BiplanarP216,
+        PixelFormat::YCC8Bit422InterleavedYUY2,
+        PixelFormat::YCC10Bit422InterleavedY210,
+        PixelFormat::YCC10Bit444InterleavedV410,
+        PixelFormat::RGB8BitInterleavedRGB,
+        PixelFormat::RGB8BitInterleavedBGR,
+        PixelFormat::RGB16BitInterleavedRGB,
+        PixelFormat::YCCA8Bit420Planar,
+        PixelFormat::YCCA8Bit444Planar,
     };
 
     std::vector<PixelFormat> validOutputFormats{
         PixelFormat::RGB8BitInterleavedBGRA,
+        PixelFormat::RGB8BitInterleavedRGBA,
+        PixelFormat::RGB8BitInterleavedARGB,
         PixelFormat::YCC8Bit420Planar,
         PixelFormat::YCC8Bit422Planar,
         PixelFormat::YCC8Bit444Planar,
+        PixelFormat::YCC8Bit420BiplanarNV12,
         PixelFormat::YCC8Bit422InterleavedUYVY,
+        PixelFormat::RGB10BitInterleavedRGBXBE,
+        PixelFormat::RGB10BitInterleavedRGBXLE,
         PixelFormat::RGB10BitInterleavedXRGBBE,
+        PixelFormat::RGB10BitInterleavedXRGBLE,
+        PixelFormat::RGB10BitInterleavedXBGRBE,
+        PixelFormat::RGB10BitInterleavedXBGRLE,
         PixelFormat::YCC10Bit420Planar,
         PixelFormat::YCC10Bit422Planar,
         PixelFormat::YCC10Bit444Planar,
+        PixelFormat::YCC10Bit420BiplanarP010,
+        PixelFormat::YCC10Bit422BiplanarP210,
+        PixelFormat::YCC10Bit444BiplanarP410,
+        PixelFormat::YCC10Bit422InterleavedV210,
+        PixelFormat::RGB12BitInterleavedBGRBE,
+        PixelFormat::RGB12BitInterleavedBGRLE,
+        PixelFormat::YCC16Bit422BiplanarP216,
+        PixelFormat::YCCA8Bit420Planar,
+        PixelFormat::YCCA8Bit444Planar,
+        PixelFormat::RGB8BitPlanarGBR,
+        PixelFormat::RGB16BitPlanarGBR,
+        PixelFormat::RGBFloat16PlanarNCHW,
+        PixelFormat::RGBFloat32PlanarNCHW,
     };
 
     struct Resolution {
@@ -656,6 +989,1273 @@ int main()
         }
     }
 
+    // Identical formats are copied row by row, regardless of stride
+    {
+        VideoFrameWrapper inputFrame = GetGradient44410BitFrame(64, 64);
+        VideoFrameWrapper outputFrame = inputFrame;
+        outputFrame.stride = inputFrame.stride + 32;
+        outputFrame.chromaStride = inputFrame.chromaStride + 32;
+        outputFrame.buffer = new uint8_t[outputFrame.GetBufferSize()];
+        std::cout << "Testing strided copy" << std::endl;
+        if (videoConverter->Convert(inputFrame, outputFrame) != Result::Success) {
+            std::cout << "Error converting" << std::endl;
+            return -1;
+        }
+        for (uint32_t row = 0; row < inputFrame.height * 3; ++row) {
+            if (memcmp(
+                    inputFrame.buffer + row * inputFrame.stride,
+                    outputFrame.buffer + row * outputFrame.stride,
+                    inputFrame.stride) != 0) {
+                std::cout << "Frames aren't equal" << std::endl;
+                return -1;
+            }
+        }
+        delete[] outputFrame.buffer;
+        delete[] inputFrame.buffer;
+    }
+
+    // Range only conversions go through lookup tables, limited range luma must expand to the full 10-bit range
+    {
+        VideoFrameWrapper inputFrame = GetGradient44410BitFrame(256, 16);
+        VideoFrameWrapper outputFrame = CreateFrame(PixelFormat::YCC10Bit444Planar, 256, 16);
+        outputFrame.isVideoFullRange = true;
+        outputFrame.lumaChromaMatrix = inputFrame.lumaChromaMatrix;
+        std::cout << "Testing range lookup tables" << std::endl;
+        if (videoConverter->Convert(inputFrame, outputFrame) != Result::Success) {
+            std::cout << "Error converting" << std::endl;
+            return -1;
+        }
+        const uint16_t* inputSamples = reinterpret_cast<const uint16_t*>(inputFrame.buffer);
+        const uint16_t* outputSamples = reinterpret_cast<const uint16_t*>(outputFrame.buffer);
+        for (uint32_t sampleIndex = 0; sampleIndex < inputFrame.width * inputFrame.height; ++sampleIndex) {
+            const int32_t expectedSample =
+                std::clamp((static_cast<int32_t>(inputSamples[sampleIndex]) - 64) * 1023 / 876, 0, 1023);
+            if (std::abs(outputSamples[sampleIndex] - expectedSample) > 1) {
+                std::cout << "Luma samples weren't expanded to full range" << std::endl;
+                return -1;
+            }
+        }
+        delete[] outputFrame.buffer;
+        delete[] inputFrame.buffer;
+    }
+
+    // V210 lines are written as whole 6 pixel groups, with partial groups and the line padding filled in
+    {
+        VideoFrameWrapper inputFrame = CreateFrame(PixelFormat::YCC10Bit422Planar, 200, 4);
+        uint16_t* inputSamples = reinterpret_cast<uint16_t*>(inputFrame.buffer);
+        const uint32_t lumaSampleCount = inputFrame.width * inputFrame.height;
+        const uint32_t chromaSampleCount = inputFrame.GetChromaWidth() * inputFrame.height;
+        std::fill_n(inputSamples, lumaSampleCount, static_cast<uint16_t>(0x100));
+        std::fill_n(inputSamples + lumaSampleCount, chromaSampleCount, static_cast<uint16_t>(0x200));
+        uint16_t* crSamples = inputSamples + lumaSampleCount + chromaSampleCount;
+        std::fill_n(crSamples, chromaSampleCount, static_cast<uint16_t>(0x300));
+        VideoFrameWrapper outputFrame = CreateFrame(PixelFormat::YCC10Bit422InterleavedV210, 200, 4);
+        outputFrame.isVideoFullRange = inputFrame.isVideoFullRange;
+        outputFrame.lumaChromaMatrix = inputFrame.lumaChromaMatrix;
+        std::fill_n(outputFrame.buffer, outputFrame.GetBufferSize(), static_cast<uint8_t>(0xFF));
+        std::cout << "Testing V210 packing" << std::endl;
+        if (videoConverter->Convert(inputFrame, outputFrame) != Result::Success) {
+            std::cout << "Error converting" << std::endl;
+            return -1;
+        }
+        const uint32_t expectedWords[4] = {
+            0x200 | (0x100 << 10) | (0x300 << 20),
+            0x100 | (0x200 << 10) | (0x100 << 20),
+            0x300 | (0x100 << 10) | (0x200 << 20),
+            0x100 | (0x300 << 10) | (0x100 << 20),
+        };
+        const uint32_t groupCount = (outputFrame.width + 5) / 6;
+        for (uint32_t line = 0; line < outputFrame.height; ++line) {
+            const uint32_t* words = reinterpret_cast<const uint32_t*>(outputFrame.buffer + line * outputFrame.stride);
+            for (uint32_t wordIndex = 0; wordIndex < outputFrame.stride / 4; ++wordIndex) {
+                const uint32_t expectedWord = wordIndex < groupCount * 4 ? expectedWords[wordIndex % 4] : 0;
+                if (words[wordIndex] != expectedWord) {
+                    std::cout << "V210 groups weren't packed as expected" << std::endl;
+                    return -1;
+                }
+            }
+        }
+
+        // Copying into a wider stride keeps the groups and zeroes the padding, like the conversion shader does
+        VideoFrameWrapper paddedFrame = outputFrame;
+        paddedFrame.stride = outputFrame.stride + 128;
+        paddedFrame.buffer = new uint8_t[paddedFrame.GetBufferSize()];
+        std::fill_n(paddedFrame.buffer, paddedFrame.GetBufferSize(), static_cast<uint8_t>(0xFF));
+        if (videoConverter->Convert(outputFrame, paddedFrame) != Result::Success) {
+            std::cout << "Error converting" << std::endl;
+            return -1;
+        }
+        for (uint32_t line = 0; line < paddedFrame.height; ++line) {
+            const uint8_t* paddedLine = paddedFrame.buffer + line * paddedFrame.stride;
+            for (uint32_t byteIndex = 0; byteIndex < paddedFrame.stride; ++byteIndex) {
+                const uint8_t expectedByte =
+                    byteIndex < outputFrame.stride ? outputFrame.buffer[line * outputFrame.stride + byteIndex] : 0;
+                if (paddedLine[byteIndex] != expectedByte) {
+                    std::cout << "V210 lines weren't copied with zeroed padding" << std::endl;
+                    return -1;
+                }
+            }
+        }
+        delete[] paddedFrame.buffer;
+        delete[] outputFrame.buffer;
+        delete[] inputFrame.buffer;
+    }
+
+    // 10-bit RGB writers must pack the samples read from another layout, big endian formats byte swap each word
+    {
+        const auto swapEndianness = [](uint32_t word) {
+            return (word >> 24) | ((word >> 8) & 0xFF00) | ((word << 8) & 0xFF0000) | (word << 24);
+        };
+        VideoFrameWrapper inputFrame = CreateFrame(PixelFormat::RGB10BitInterleavedXRGBLE, 64, 16);
+        uint32_t* inputWords = reinterpret_cast<uint32_t*>(inputFrame.buffer);
+        for (uint32_t pixelIndex = 0; pixelIndex < inputFrame.width * inputFrame.height; ++pixelIndex) {
+            const uint32_t r = (pixelIndex * 7) % 1024, g = (pixelIndex * 13) % 1024, b = (pixelIndex * 29) % 1024;
+            inputWords[pixelIndex] = (r << 20) | (g << 10) | b;
+        }
+        VideoFrameWrapper outputFrame = CreateFrame(PixelFormat::RGB10BitInterleavedXBGRBE, 64, 16);
+        std::cout << "Testing 10-bit RGB packing" << std::endl;
+        if (videoConverter->Convert(inputFrame, outputFrame) != Result::Success) {
+            std::cout << "Error converting" << std::endl;
+            return -1;
+        }
+        const uint32_t* outputWords = reinterpret_cast<const uint32_t*>(outputFrame.buffer);
+        for (uint32_t pixelIndex = 0; pixelIndex < inputFrame.width * inputFrame.height; ++pixelIndex) {
+            const uint32_t r = (inputWords[pixelIndex] >> 20) & 0x3FF;
+            const uint32_t g = (inputWords[pixelIndex] >> 10) & 0x3FF;
+            const uint32_t b = inputWords[pixelIndex] & 0x3FF;
+            if (outputWords[pixelIndex] != swapEndianness((b << 20) | (g << 10) | r)) {
+                std::cout << "10-bit RGB samples weren't packed as expected" << std::endl;
+                return -1;
+            }
+        }
+        delete[] outputFrame.buffer;
+        delete[] inputFrame.buffer;
+    }
+
+    // 12-bit RGB groups must round trip between byte orders, which only differ in the order of bytes within words
+    {
+        VideoFrameWrapper inputFrame = CreateFrame(PixelFormat::RGB12BitInterleavedBGRBE, 96, 16);
+        for (uint32_t byteIndex = 0; byteIndex < inputFrame.GetBufferSize(); ++byteIndex) {
+            inputFrame.buffer[byteIndex] = static_cast<uint8_t>(byteIndex * 37 + 11);
+        }
+        VideoFrameWrapper outputFrame = CreateFrame(PixelFormat::RGB12BitInterleavedBGRLE, 96, 16);
+        std::cout << "Testing 12-bit RGB packing" << std::endl;
+        if (videoConverter->Convert(inputFrame, outputFrame) != Result::Success) {
+            std::cout << "Error converting" << std::endl;
+            return -1;
+        }
+        for (uint32_t byteIndex = 0; byteIndex < inputFrame.GetBufferSize(); ++byteIndex) {
+            if (outputFrame.buffer[byteIndex] != inputFrame.buffer[(byteIndex / 4) * 4 + 3 - byteIndex % 4]) {
+                std::cout << "12-bit RGB groups weren't packed as expected" << std::endl;
+                return -1;
+            }
+        }
+        delete[] outputFrame.buffer;
+        delete[] inputFrame.buffer;
+    }
+
+    // YUY2 and UYVY only differ in the order of samples within macropixels
+    {
+        VideoFrameWrapper inputFrame = CreateFrame(PixelFormat::YCC8Bit422InterleavedYUY2, 64, 16);
+        for (uint32_t byteIndex = 0; byteIndex < inputFrame.GetBufferSize(); ++byteIndex) {
+            inputFrame.buffer[byteIndex] = static_cast<uint8_t>(16 + (byteIndex * 7) % 220);
+        }
+        VideoFrameWrapper outputFrame = CreateFrame(PixelFormat::YCC8Bit422InterleavedUYVY, 64, 16);
+        outputFrame.isVideoFullRange = inputFrame.isVideoFullRange;
+        outputFrame.lumaChromaMatrix = inputFrame.lumaChromaMatrix;
+        std::cout << "Testing YUY2 reading" << std::endl;
+        if (videoConverter->Convert(inputFrame, outputFrame) != Result::Success) {
+            std::cout << "Error converting" << std::endl;
+            return -1;
+        }
+        for (uint32_t byteIndex = 0; byteIndex < inputFrame.GetBufferSize(); ++byteIndex) {
+            const uint32_t swappedByteIndex = byteIndex % 2 == 0 ? byteIndex + 1 : byteIndex - 1;
+            if (outputFrame.buffer[byteIndex] != inputFrame.buffer[swappedByteIndex]) {
+                std::cout << "YUY2 samples weren't read as expected" << std::endl;
+                return -1;
+            }
+        }
+        delete[] outputFrame.buffer;
+        delete[] inputFrame.buffer;
+    }
+
+    // Alpha is carried through color conversion, from RGBA to a YUVA alpha plane and back to BGRA
+    {
+        VideoFrameWrapper inputFrame = CreateFrame(PixelFormat::RGB8BitInterleavedRGBA, 64, 16);
+        for (uint32_t pixelIndex = 0; pixelIndex < inputFrame.width * inputFrame.height; ++pixelIndex) {
+            inputFrame.buffer[pixelIndex * 4 + 3] = static_cast<uint8_t>(pixelIndex * 5);
+        }
+        VideoFrameWrapper yuvaFrame = CreateFrame(PixelFormat::YCCA8Bit444Planar, 64, 16);
+        VideoFrameWrapper outputFrame = CreateFrame(PixelFormat::RGB8BitInterleavedBGRA, 64, 16);
+        std::cout << "Testing alpha passthrough" << std::endl;
+        if (videoConverter->Convert(inputFrame, yuvaFrame) != Result::Success ||
+            videoConverter->Convert(yuvaFrame, outputFrame) != Result::Success) {
+            std::cout << "Error converting" << std::endl;
+            return -1;
+        }
+        const uint8_t* alphaSamples = yuvaFrame.buffer + yuvaFrame.GetAlphaOffset();
+        for (uint32_t pixelIndex = 0; pixelIndex < inputFrame.width * inputFrame.height; ++pixelIndex) {
+            const uint8_t alpha = inputFrame.buffer[pixelIndex * 4 + 3];
+            if (alphaSamples[pixelIndex] != alpha || outputFrame.buffer[pixelIndex * 4 + 3] != alpha) {
+                std::cout << "Alpha samples weren't preserved" << std::endl;
+                return -1;
+            }
+        }
+        delete[] outputFrame.buffer;
+        delete[] yuvaFrame.buffer;
+        delete[] inputFrame.buffer;
+    }
+
+    // Planar GBR repacks RGB samples exactly, float tensors apply the per-channel scale and bias
+    {
+        VideoConverterConfig tensorConfig;
+        tensorConfig.tensorScale = {2.0f, 1.0f, 0.5f};
+        tensorConfig.tensorBias = {-1.0f, 0.0f, 0.25f};
+        const auto tensorVideoConverter = device->CreateVideoConverter(tensorConfig);
+
+        VideoFrameWrapper inputFrame = CreateFrame(PixelFormat::RGB8BitInterleavedRGBA, 64, 16);
+        const uint32_t pixelCount = inputFrame.width * inputFrame.height;
+        for (uint32_t pixelIndex = 0; pixelIndex < pixelCount; ++pixelIndex) {
+            inputFrame.buffer[pixelIndex * 4] = static_cast<uint8_t>(pixelIndex);
+            inputFrame.buffer[pixelIndex * 4 + 1] = static_cast<uint8_t>(pixelIndex * 3);
+            inputFrame.buffer[pixelIndex * 4 + 2] = static_cast<uint8_t>(255 - pixelIndex);
+        }
+        VideoFrameWrapper gbrFrame = CreateFrame(PixelFormat::RGB8BitPlanarGBR, 64, 16);
+        VideoFrameWrapper tensorFrame = CreateFrame(PixelFormat::RGBFloat32PlanarNCHW, 64, 16);
+        VideoFrameWrapper halfTensorFrame = CreateFrame(PixelFormat::RGBFloat16PlanarNCHW, 64, 16);
+        std::cout << "Testing planar RGB and tensor outputs" << std::endl;
+        if (tensorVideoConverter->Convert(inputFrame, gbrFrame) != Result::Success ||
+            tensorVideoConverter->Convert(inputFrame, tensorFrame) != Result::Success ||
+            tensorVideoConverter->Convert(inputFrame, halfTensorFrame) != Result::Success) {
+            std::cout << "Error converting" << std::endl;
+            return -1;
+        }
+        const float* tensorValues = reinterpret_cast<const float*>(tensorFrame.buffer);
+        const uint16_t* halfTensorValues = reinterpret_cast<const uint16_t*>(halfTensorFrame.buffer);
+        for (uint32_t pixelIndex = 0; pixelIndex < pixelCount; ++pixelIndex) {
+            for (uint32_t channel = 0; channel < 3; ++channel) {
+                const uint8_t sample = inputFrame.buffer[pixelIndex * 4 + channel];
+                // GBR plane order puts red last
+                const uint32_t gbrPlane = (channel + 2) % 3;
+                const float expectedValue =
+                    sample / 255.0f * tensorConfig.tensorScale[channel] + tensorConfig.tensorBias[channel];
+                if (gbrFrame.buffer[gbrPlane * pixelCount + pixelIndex] != sample ||
+                    std::abs(tensorValues[channel * pixelCount + pixelIndex] - expectedValue) > 1e-3f) {
+                    std::cout << "Planar RGB samples weren't written as expected" << std::endl;
+                    return -1;
+                }
+                // Half floats keep 11 significant bits, values up to 1 must be within two half precision steps
+                if (std::abs(HalfToFloat(halfTensorValues[channel * pixelCount + pixelIndex]) - expectedValue) >
+                    2e-3f) {
+                    std::cout << "Half precision tensor samples weren't written as expected" << std::endl;
+                    return -1;
+                }
+            }
+        }
+        delete[] halfTensorFrame.buffer;
+        delete[] tensorFrame.buffer;
+        delete[] gbrFrame.buffer;
+        delete[] inputFrame.buffer;
+        tensorVideoConverter->Release();
+    }
+
+    // A source crop placed inside the destination is copied as is, the rest of the destination gets the fill color
+    {
+        VideoFrameWrapper inputFrame = CreateFrame(PixelFormat::RGB8BitInterleavedRGBA, 64, 16);
+        for (uint32_t pixelIndex = 0; pixelIndex < inputFrame.width * inputFrame.height; ++pixelIndex) {
+            inputFrame.buffer[pixelIndex * 4] = static_cast<uint8_t>(pixelIndex);
+            inputFrame.buffer[pixelIndex * 4 + 1] = static_cast<uint8_t>(pixelIndex * 3);
+            inputFrame.buffer[pixelIndex * 4 + 2] = static_cast<uint8_t>(pixelIndex * 7);
+        }
+        inputFrame.cropRect = {16.0f, 4.0f, 32.0f, 8.0f};
+        VideoFrameWrapper outputFrame = CreateFrame(PixelFormat::RGB8BitInterleavedBGRA, 64, 16);
+        outputFrame.placementRect = {8.0f, 4.0f, 32.0f, 8.0f};
+        outputFrame.fillColor = {1.0f, 0.0f, 0.0f};
+        std::cout << "Testing crop and placement" << std::endl;
+        if (videoConverter->Convert(inputFrame, outputFrame) != Result::Success) {
+            std::cout << "Error converting" << std::endl;
+            return -1;
+        }
+        for (uint32_t y = 0; y < outputFrame.height; ++y) {
+            for (uint32_t x = 0; x < outputFrame.width; ++x) {
+                const uint8_t* outputPixel = outputFrame.buffer + y * outputFrame.stride + x * 4;
+                const bool isPlaced = x >= 8 && x < 40 && y >= 4 && y < 12;
+                const uint8_t* inputPixel = inputFrame.buffer + y * inputFrame.stride + (x + 8) * 4;
+                const uint8_t expectedPixel[3] = {
+                    isPlaced ? inputPixel[2] : uint8_t(0),
+                    isPlaced ? inputPixel[1] : uint8_t(0),
+                    isPlaced ? inputPixel[0] : uint8_t(0xFF),
+                };
+                if (std::memcmp(outputPixel, expectedPixel, 3) != 0) {
+                    std::cout << "Cropped and placed pixels weren't written as expected" << std::endl;
+                    return -1;
+                }
+            }
+        }
+        delete[] outputFrame.buffer;
+        delete[] inputFrame.buffer;
+    }
+
+    // Rotations move whole pixels, so they're exact when the rotated source matches the destination size
+    {
+        VideoFrameWrapper inputFrame = CreateFrame(PixelFormat::RGB8BitInterleavedRGBA, 64, 16);
+        for (uint32_t pixelIndex = 0; pixelIndex < inputFrame.width * inputFrame.height; ++pixelIndex) {
+            inputFrame.buffer[pixelIndex * 4] = static_cast<uint8_t>(pixelIndex);
+            inputFrame.buffer[pixelIndex * 4 + 1] = static_cast<uint8_t>(pixelIndex / 256);
+        }
+        inputFrame.orientation = VideoFrameOrientation::Rotate90;
+        VideoFrameWrapper outputFrame = CreateFrame(PixelFormat::RGB8BitInterleavedRGBA, 16, 64);
+        std::cout << "Testing rotation" << std::endl;
+        if (videoConverter->Convert(inputFrame, outputFrame) != Result::Success) {
+            std::cout << "Error converting" << std::endl;
+            return -1;
+        }
+        for (uint32_t y = 0; y < outputFrame.height; ++y) {
+            for (uint32_t x = 0; x < outputFrame.width; ++x) {
+                // Clockwise, the first source row becomes the last destination column
+                const uint8_t* inputPixel =
+                    inputFrame.buffer + (inputFrame.height - 1 - x) * inputFrame.stride + y * 4;
+                if (std::memcmp(outputFrame.buffer + y * outputFrame.stride + x * 4, inputPixel, 4) != 0) {
+                    std::cout << "Rotated pixels weren't written as expected" << std::endl;
+                    return -1;
+                }
+            }
+        }
+        delete[] outputFrame.buffer;
+        delete[] inputFrame.buffer;
+    }
+
+    // Left sited 4:2:2 chroma keeps its samples on even columns and is interpolated halfway on odd ones, instead of
+    // being replicated
+    {
+        VideoFrameWrapper inputFrame = CreateFrame(PixelFormat::YCC8Bit422Planar, 64, 16);
+        inputFrame.chromaSiting = ChromaSiting::Left;
+        const uint32_t chromaSampleCount = inputFrame.GetChromaWidth() * inputFrame.height;
+        uint8_t* cbSamples = inputFrame.buffer + inputFrame.GetCbOffset();
+        for (uint32_t sampleIndex = 0; sampleIndex < chromaSampleCount; ++sampleIndex) {
+            cbSamples[sampleIndex] = sampleIndex % 2 == 0 ? 64 : 192;
+        }
+        std::fill_n(inputFrame.buffer + inputFrame.GetCrOffset(), chromaSampleCount, static_cast<uint8_t>(128));
+        VideoFrameWrapper outputFrame = CreateFrame(PixelFormat::YCC8Bit444Planar, 64, 16);
+        outputFrame.isVideoFullRange = inputFrame.isVideoFullRange;
+        outputFrame.lumaChromaMatrix = inputFrame.lumaChromaMatrix;
+        std::cout << "Testing chroma siting" << std::endl;
+        if (videoConverter->Convert(inputFrame, outputFrame) != Result::Success) {
+            std::cout << "Error converting" << std::endl;
+            return -1;
+        }
+        const uint8_t* outputCbSamples = outputFrame.buffer + outputFrame.GetCbOffset();
+        for (uint32_t y = 0; y < outputFrame.height; ++y) {
+            // The outermost columns blend in replicated edge samples
+            for (uint32_t x = 2; x < outputFrame.width - 3; ++x) {
+                const int expectedSample = x % 2 == 1 ? 128 : cbSamples[y * inputFrame.chromaStride + x / 2];
+                if (std::abs(outputCbSamples[y * outputFrame.chromaStride + x] - expectedSample) > 1) {
+                    std::cout << "Chroma wasn't interpolated at its siting" << std::endl;
+                    return -1;
+                }
+            }
+        }
+        delete[] outputFrame.buffer;
+        delete[] inputFrame.buffer;
+    }
+
+    // Co-sited chroma filters replicate the placement edges instead of blending in the fill color around them
+    {
+        VideoFrameWrapper inputFrame = CreateFrame(PixelFormat::YCC8Bit444Planar, 32, 16);
+        const uint32_t sampleCount = inputFrame.width * inputFrame.height;
+        std::fill_n(inputFrame.buffer, sampleCount, static_cast<uint8_t>(128));
+        std::fill_n(inputFrame.buffer + sampleCount, sampleCount, static_cast<uint8_t>(100));
+        std::fill_n(inputFrame.buffer + sampleCount * 2, sampleCount, static_cast<uint8_t>(150));
+        std::cout << "Testing co-sited chroma at the placement edges" << std::endl;
+        const std::vector<std::pair<PixelFormat, ChromaSiting>> cositedFormats = {
+            {PixelFormat::YCC8Bit420Planar, ChromaSiting::TopLeft},
+            {PixelFormat::YCC8Bit420Planar, ChromaSiting::Left},
+            {PixelFormat::YCC8Bit422Planar, ChromaSiting::Left},
+        };
+        for (const auto& [pixelFormat, chromaSiting] : cositedFormats) {
+            VideoFrameWrapper outputFrame = CreateFrame(pixelFormat, 64, 32);
+            outputFrame.isVideoFullRange = inputFrame.isVideoFullRange;
+            outputFrame.lumaChromaMatrix = inputFrame.lumaChromaMatrix;
+            outputFrame.chromaSiting = chromaSiting;
+            outputFrame.placementRect = {8.0f, 8.0f, 32.0f, 16.0f};
+            outputFrame.fillColor = {1.0f, 0.0f, 0.0f};
+            if (videoConverter->Convert(inputFrame, outputFrame) != Result::Success) {
+                std::cout << "Error converting" << std::endl;
+                return -1;
+            }
+            const uint32_t chromaScaleY = outputFrame.height / outputFrame.GetChromaHeight();
+            const uint8_t* cbSamples = outputFrame.buffer + outputFrame.GetCbOffset();
+            const uint8_t* crSamples = outputFrame.buffer + outputFrame.GetCrOffset();
+            for (uint32_t y = 8 / chromaScaleY; y < 24 / chromaScaleY; ++y) {
+                for (uint32_t x = 4; x < 20; ++x) {
+                    const uint32_t sampleIndex = y * outputFrame.GetChromaStride() + x;
+                    if (cbSamples[sampleIndex] != 100 || crSamples[sampleIndex] != 150) {
+                        std::cout << "Fill color bled into the placed chroma of " << GetFormatName(pixelFormat)
+                                  << std::endl;
+                        return -1;
+                    }
+                }
+            }
+            delete[] outputFrame.buffer;
+        }
+        delete[] inputFrame.buffer;
+    }
+
+    // Bob deinterlacing keeps the top field of a top field first frame and interpolates the bottom field lines from it
+    {
+        VideoConverterConfig bobConfig;
+        bobConfig.deinterlacing = Deinterlacing::Bob;
+        const auto bobVideoConverter = device->CreateVideoConverter(bobConfig);
+
+        VideoFrameWrapper inputFrame = CreateFrame(PixelFormat::RGB8BitInterleavedRGBA, 64, 16);
+        inputFrame.fieldOrder = FieldOrder::TopFieldFirst;
+        for (uint32_t y = 0; y < inputFrame.height; ++y) {
+            const uint8_t fieldSample = y % 2 == 0 ? 0x20 : 0xE0;
+            std::fill_n(inputFrame.buffer + y * inputFrame.stride, inputFrame.width * 4, fieldSample);
+        }
+        VideoFrameWrapper outputFrame = CreateFrame(PixelFormat::RGB8BitInterleavedRGBA, 64, 16);
+        std::cout << "Testing deinterlacing" << std::endl;
+        if (bobVideoConverter->Convert(inputFrame, outputFrame) != Result::Success) {
+            std::cout << "Error converting" << std::endl;
+            return -1;
+        }
+        for (uint32_t y = 0; y < outputFrame.height; ++y) {
+            for (uint32_t x = 0; x < outputFrame.width; ++x) {
+                const uint8_t* outputPixel = outputFrame.buffer + y * outputFrame.stride + x * 4;
+                if (outputPixel[0] != 0x20 || outputPixel[1] != 0x20 || outputPixel[2] != 0x20) {
+                    std::cout << "Bottom field lines weren't replaced" << std::endl;
+                    return -1;
+                }
+            }
+        }
+        delete[] outputFrame.buffer;
+        delete[] inputFrame.buffer;
+        bobVideoConverter->Release();
+    }
+
+    // An opaque overlay replaces the pixels it covers and a half transparent one blends with them, leaving the rest of
+    // the frame untouched
+    {
+        const auto overlayVideoConverter = device->CreateVideoConverter();
+
+        VideoFrameWrapper inputFrame = CreateFrame(PixelFormat::RGB8BitInterleavedRGBA, 64, 16);
+        std::fill_n(inputFrame.buffer, inputFrame.stride * inputFrame.height, static_cast<uint8_t>(0x00));
+        VideoFrameWrapper outputFrame = CreateFrame(PixelFormat::RGB8BitInterleavedRGBA, 64, 16);
+        std::vector<uint8_t> overlayPixels(8 * 4 * 4, 0xFF);
+        VideoOverlay opaqueOverlay;
+        opaqueOverlay.buffer = overlayPixels.data();
+        opaqueOverlay.width = 8;
+        opaqueOverlay.height = 4;
+        opaqueOverlay.x = 4;
+        opaqueOverlay.y = 2;
+        VideoOverlay halfOverlay = opaqueOverlay;
+        halfOverlay.x = 32;
+        halfOverlay.alpha = 0.5f;
+        std::cout << "Testing overlays" << std::endl;
+        if (overlayVideoConverter->SetOverlays({opaqueOverlay, halfOverlay}) != Result::Success ||
+            overlayVideoConverter->Convert(inputFrame, outputFrame) != Result::Success) {
+            std::cout << "Error converting" << std::endl;
+            return -1;
+        }
+        for (uint32_t y = 0; y < outputFrame.height; ++y) {
+            for (uint32_t x = 0; x < outputFrame.width; ++x) {
+                const bool isInOverlayRows = y >= 2 && y < 6;
+                int expectedSample = 0x00;
+                if (isInOverlayRows && x >= 4 && x < 12) {
+                    expectedSample = 0xFF;
+                } else if (isInOverlayRows && x >= 32 && x < 40) {
+                    expectedSample = 0x80;
+                }
+                if (std::abs(outputFrame.buffer[y * outputFrame.stride + x * 4] - expectedSample) > 1) {
+                    std::cout << "Overlays weren't composited" << std::endl;
+                    return -1;
+                }
+            }
+        }
+
+        VideoOverlay invalidOverlay = opaqueOverlay;
+        invalidOverlay.alpha = 2.0f;
+        if (overlayVideoConverter->SetOverlays({invalidOverlay}) != Result::InvalidOverlayError) {
+            std::cout << "Invalid overlay was accepted" << std::endl;
+            return -1;
+        }
+        delete[] outputFrame.buffer;
+        delete[] inputFrame.buffer;
+        overlayVideoConverter->Release();
+    }
+
+    // Tiles of different formats and sizes are scaled into their rectangles of a single frame, the rest of the frame
+    // gets the fill color
+    {
+        VideoFrameWrapper rgbaFrame = CreateFrame(PixelFormat::RGB8BitInterleavedRGBA, 16, 8);
+        for (uint32_t pixelIndex = 0; pixelIndex < rgbaFrame.width * rgbaFrame.height; ++pixelIndex) {
+            rgbaFrame.buffer[pixelIndex * 4] = 0x40;
+            rgbaFrame.buffer[pixelIndex * 4 + 1] = 0x80;
+            rgbaFrame.buffer[pixelIndex * 4 + 2] = 0xC0;
+        }
+        VideoFrameWrapper yccFrame = CreateFrame(PixelFormat::YCC8Bit444Planar, 16, 16);
+        std::fill_n(yccFrame.buffer, yccFrame.GetCbOffset(), static_cast<uint8_t>(235));
+        std::fill_n(
+            yccFrame.buffer + yccFrame.GetCbOffset(),
+            yccFrame.GetBufferSize() - yccFrame.GetCbOffset(),
+            static_cast<uint8_t>(128));
+        VideoFrameWrapper outputFrame = CreateFrame(PixelFormat::RGB8BitInterleavedRGBA, 64, 16);
+        outputFrame.fillColor = {0.0f, 0.0f, 1.0f};
+        const std::vector<VideoTile> tiles{
+            {rgbaFrame, {0.0f, 0.0f, 32.0f, 16.0f}},
+            {yccFrame, {32.0f, 0.0f, 16.0f, 16.0f}},
+        };
+        std::cout << "Testing tile composition" << std::endl;
+        if (videoConverter->Compose(tiles, outputFrame) != Result::Success) {
+            std::cout << "Error composing" << std::endl;
+            return -1;
+        }
+        for (uint32_t y = 0; y < outputFrame.height; ++y) {
+            for (uint32_t x = 0; x < outputFrame.width; ++x) {
+                const uint8_t* outputPixel = outputFrame.buffer + y * outputFrame.stride + x * 4;
+                bool isExpected = false;
+                if (x < 32) {
+                    isExpected = std::abs(outputPixel[0] - 0x40) <= 1 && std::abs(outputPixel[1] - 0x80) <= 1 &&
+                                 std::abs(outputPixel[2] - 0xC0) <= 1;
+                } else if (x < 48) {
+                    isExpected = outputPixel[0] >= 0xC0 && std::abs(outputPixel[0] - outputPixel[1]) <= 1 &&
+                                 std::abs(outputPixel[0] - outputPixel[2]) <= 1;
+                } else {
+                    isExpected = outputPixel[0] == 0 && outputPixel[1] == 0 && outputPixel[2] == 0xFF;
+                }
+                if (!isExpected) {
+                    std::cout << "Tiles weren't composed into their rectangles" << std::endl;
+                    return -1;
+                }
+            }
+        }
+
+        const std::vector<VideoTile> overlappingTiles{
+            {rgbaFrame, {0.0f, 0.0f, 32.0f, 16.0f}},
+            {yccFrame, {16.0f, 0.0f, 16.0f, 16.0f}},
+        };
+        if (videoConverter->Compose(overlappingTiles, outputFrame) != Result::InvalidTileError) {
+            std::cout << "Overlapping tiles were accepted" << std::endl;
+            return -1;
+        }
+
+        // Interlaced 4:2:0 chroma is filtered within each field, so stacked tiles split on whole block pairs and keep
+        // their own chroma
+        VideoFrameWrapper topFrame = CreateFrame(PixelFormat::YCC8Bit444Planar, 32, 8);
+        VideoFrameWrapper bottomFrame = CreateFrame(PixelFormat::YCC8Bit444Planar, 32, 8);
+        const uint32_t tileSampleCount = topFrame.width * topFrame.height;
+        for (const auto& [tileFrame, cbSample, crSample] :
+             {std::tuple{&topFrame, 100, 150}, std::tuple{&bottomFrame, 160, 90}}) {
+            std::fill_n(tileFrame->buffer, tileSampleCount, static_cast<uint8_t>(128));
+            std::fill_n(tileFrame->buffer + tileSampleCount, tileSampleCount, static_cast<uint8_t>(cbSample));
+            std::fill_n(tileFrame->buffer + tileSampleCount * 2, tileSampleCount, static_cast<uint8_t>(crSample));
+        }
+        VideoFrameWrapper interlacedFrame = CreateFrame(PixelFormat::YCC8Bit420Planar, 32, 16);
+        interlacedFrame.isVideoFullRange = topFrame.isVideoFullRange;
+        interlacedFrame.lumaChromaMatrix = topFrame.lumaChromaMatrix;
+        interlacedFrame.fieldOrder = FieldOrder::TopFieldFirst;
+        const std::vector<VideoTile> fieldTiles{
+            {topFrame, {0.0f, 0.0f, 32.0f, 8.0f}},
+            {bottomFrame, {0.0f, 8.0f, 32.0f, 8.0f}},
+        };
+        if (videoConverter->Compose(fieldTiles, interlacedFrame) != Result::Success) {
+            std::cout << "Error composing" << std::endl;
+            return -1;
+        }
+        const uint8_t* cbSamples = interlacedFrame.buffer + interlacedFrame.GetCbOffset();
+        const uint8_t* crSamples = interlacedFrame.buffer + interlacedFrame.GetCrOffset();
+        for (uint32_t y = 0; y < interlacedFrame.GetChromaHeight(); ++y) {
+            for (uint32_t x = 0; x < interlacedFrame.GetChromaWidth(); ++x) {
+                const uint32_t sampleIndex = y * interlacedFrame.GetChromaStride() + x;
+                const bool isTopTile = y < 4;
+                if (cbSamples[sampleIndex] != (isTopTile ? 100 : 160) ||
+                    crSamples[sampleIndex] != (isTopTile ? 150 : 90)) {
+                    std::cout << "Field chroma was filtered across tiles" << std::endl;
+                    return -1;
+                }
+            }
+        }
+        const std::vector<VideoTile> halfPairTiles{
+            {topFrame, {0.0f, 0.0f, 32.0f, 6.0f}},
+            {bottomFrame, {0.0f, 6.0f, 32.0f, 10.0f}},
+        };
+        if (videoConverter->Compose(halfPairTiles, interlacedFrame) != Result::InvalidTileError) {
+            std::cout << "Tiles splitting a field chroma block pair were accepted" << std::endl;
+            return -1;
+        }
+        delete[] interlacedFrame.buffer;
+        delete[] bottomFrame.buffer;
+        delete[] topFrame.buffer;
+        delete[] outputFrame.buffer;
+        delete[] yccFrame.buffer;
+        delete[] rgbaFrame.buffer;
+    }
+
+    // Statistics count the converted pixels of the placement only, with black luma below the full range
+    {
+        VideoConverterConfig statisticsConfig;
+        statisticsConfig.collectStatistics = true;
+        const auto statisticsVideoConverter = device->CreateVideoConverter(statisticsConfig);
+
+        VideoFrameWrapper inputFrame = CreateFrame(PixelFormat::YCC8Bit444Planar, 32, 16);
+        const uint32_t halfLumaSize = inputFrame.GetCbOffset() / 2;
+        std::fill_n(inputFrame.buffer, halfLumaSize, static_cast<uint8_t>(0));
+        std::fill_n(inputFrame.buffer + halfLumaSize, halfLumaSize, static_cast<uint8_t>(200));
+        std::fill_n(
+            inputFrame.buffer + inputFrame.GetCbOffset(),
+            inputFrame.GetBufferSize() - inputFrame.GetCbOffset(),
+            static_cast<uint8_t>(128));
+        VideoFrameWrapper outputFrame = CreateFrame(PixelFormat::YCC8Bit444Planar, 64, 16);
+        outputFrame.placementRect = {0.0f, 0.0f, 32.0f, 16.0f};
+        std::cout << "Testing frame statistics" << std::endl;
+        if (statisticsVideoConverter->Convert(inputFrame, outputFrame) != Result::Success) {
+            std::cout << "Error converting" << std::endl;
+            return -1;
+        }
+        const FrameStatistics statistics = statisticsVideoConverter->GetFrameStatistics();
+        const uint32_t halfPixelCount = inputFrame.width * inputFrame.height / 2;
+        if (statistics.pixelCount != halfPixelCount * 2 || statistics.lumaHistogram[0] != halfPixelCount ||
+            statistics.lumaHistogram[200] != halfPixelCount || statistics.minSamples[0] != 0 ||
+            statistics.maxSamples[0] != 200 || statistics.meanSamples[0] != 100.0 || statistics.minSamples[1] != 128 ||
+            statistics.maxSamples[2] != 128 || statistics.belowRangeSampleCount != halfPixelCount ||
+            statistics.aboveRangeSampleCount != 0) {
+            std::cout << "Frame statistics are wrong" << std::endl;
+            return -1;
+        }
+        delete[] outputFrame.buffer;
+        delete[] inputFrame.buffer;
+        statisticsVideoConverter->Release();
+    }
+
+    // Only the tile holding a changed pixel is reported, and unchanged frames leave the destination they were last read
+    // back into untouched
+    {
+        VideoConverterConfig changeDetectionConfig;
+        changeDetectionConfig.detectChanges = true;
+        changeDetectionConfig.skipUnchangedFrameReadback = true;
+        const auto changeDetectionVideoConverter = device->CreateVideoConverter(changeDetectionConfig);
+
+        VideoFrameWrapper inputFrame = CreateFrame(PixelFormat::RGB8BitInterleavedRGBA, 192, 64);
+        for (uint32_t sampleIndex = 0; sampleIndex < inputFrame.GetBufferSize(); ++sampleIndex) {
+            inputFrame.buffer[sampleIndex] = static_cast<uint8_t>(sampleIndex * 7);
+        }
+        VideoFrameWrapper outputFrame = CreateFrame(PixelFormat::RGB8BitInterleavedRGBA, 192, 64);
+        std::cout << "Testing change detection" << std::endl;
+        if (changeDetectionVideoConverter->Convert(inputFrame, outputFrame) != Result::Success ||
+            !changeDetectionVideoConverter->GetFrameChanges().isFrameChanged) {
+            std::cout << "First frame wasn't reported as changed" << std::endl;
+            return -1;
+        }
+
+        std::fill_n(outputFrame.buffer, outputFrame.GetBufferSize(), static_cast<uint8_t>(0x55));
+        if (changeDetectionVideoConverter->Convert(inputFrame, outputFrame) != Result::Success ||
+            changeDetectionVideoConverter->GetFrameChanges().isFrameChanged || outputFrame.buffer[0] != 0x55) {
+            std::cout << "Unchanged frame was reported as changed or read back" << std::endl;
+            return -1;
+        }
+
+        // Another destination buffer doesn't hold the frame yet, so it's read back even though nothing changed
+        VideoFrameWrapper otherOutputFrame = CreateFrame(PixelFormat::RGB8BitInterleavedRGBA, 192, 64);
+        std::fill_n(otherOutputFrame.buffer, otherOutputFrame.GetBufferSize(), static_cast<uint8_t>(0x55));
+        if (changeDetectionVideoConverter->Convert(inputFrame, otherOutputFrame) != Result::Success ||
+            changeDetectionVideoConverter->GetFrameChanges().isFrameChanged) {
+            std::cout << "Unchanged frame was reported as changed" << std::endl;
+            return -1;
+        }
+        for (uint32_t pixelIndex = 0; pixelIndex < inputFrame.width * inputFrame.height; ++pixelIndex) {
+            if (std::memcmp(otherOutputFrame.buffer + pixelIndex * 4, inputFrame.buffer + pixelIndex * 4, 3) != 0) {
+                std::cout << "Unchanged frame wasn't read back into another buffer" << std::endl;
+                return -1;
+            }
+        }
+        delete[] otherOutputFrame.buffer;
+
+        inputFrame.buffer[10 * inputFrame.stride + 70 * 4] ^= 0xFF;
+        if (changeDetectionVideoConverter->Convert(inputFrame, outputFrame) != Result::Success) {
+            std::cout << "Error converting" << std::endl;
+            return -1;
+        }
+        const FrameChanges changes = changeDetectionVideoConverter->GetFrameChanges();
+        if (changes.tileCountX != 3 || changes.tileCountY != 1 || changes.changedTileMask.size() != 1 ||
+            changes.changedTileMask[0] != 0x02) {
+            std::cout << "Changed tiles are wrong" << std::endl;
+            return -1;
+        }
+        delete[] outputFrame.buffer;
+        delete[] inputFrame.buffer;
+        changeDetectionVideoConverter->Release();
+    }
+
+    // SDR colors survive a round trip through a 10-bit PQ signal with BT.2020 primaries
+    {
+        VideoFrameWrapper inputFrame = CreateFrame(PixelFormat::RGB8BitInterleavedRGBA, 64, 16);
+        for (uint32_t pixelIndex = 0; pixelIndex < inputFrame.width * inputFrame.height; ++pixelIndex) {
+            inputFrame.buffer[pixelIndex * 4] = static_cast<uint8_t>(pixelIndex);
+            inputFrame.buffer[pixelIndex * 4 + 1] = static_cast<uint8_t>(pixelIndex * 3);
+            inputFrame.buffer[pixelIndex * 4 + 2] = static_cast<uint8_t>(255 - pixelIndex);
+        }
+        VideoFrameWrapper hdrFrame = CreateFrame(PixelFormat::YCC10Bit444Planar, 64, 16);
+        hdrFrame.lumaChromaMatrix = LumaChromaMatrix::BT2020NCL;
+        hdrFrame.transferFunction = TransferFunction::PQ;
+        hdrFrame.colorPrimaries = ColorPrimaries::BT2020;
+        VideoFrameWrapper outputFrame = CreateFrame(PixelFormat::RGB8BitInterleavedRGBA, 64, 16);
+        std::cout << "Testing transfer function and primaries conversion" << std::endl;
+        if (videoConverter->Convert(inputFrame, hdrFrame) != Result::Success ||
+            videoConverter->Convert(hdrFrame, outputFrame) != Result::Success) {
+            std::cout << "Error converting" << std::endl;
+            return -1;
+        }
+        for (uint32_t sampleIndex = 0; sampleIndex < inputFrame.width * inputFrame.height * 4; ++sampleIndex) {
+            if (std::abs(inputFrame.buffer[sampleIndex] - outputFrame.buffer[sampleIndex]) > 2) {
+                std::cout << "Frames differ by more than 2 LSB" << std::endl;
+                return -1;
+            }
+        }
+        delete[] outputFrame.buffer;
+        delete[] hdrFrame.buffer;
+        delete[] inputFrame.buffer;
+    }
+
+    // BT.2390 tone mapping lands the 1000 cd/m2 source peak on SDR white and rolls off 400 cd/m2 greys below it,
+    // where a plain conversion would clip both
+    {
+        VideoConverterConfig toneMappingConfig;
+        toneMappingConfig.toneMapping = ToneMapping::BT2390;
+        const auto toneMappingVideoConverter = device->CreateVideoConverter(toneMappingConfig);
+
+        VideoFrameWrapper inputFrame = CreateFrame(PixelFormat::YCC10Bit444Planar, 64, 16);
+        inputFrame.isVideoFullRange = true;
+        inputFrame.lumaChromaMatrix = LumaChromaMatrix::BT2020NCL;
+        inputFrame.transferFunction = TransferFunction::PQ;
+        inputFrame.colorPrimaries = ColorPrimaries::BT2020;
+        uint16_t* inputSamples = reinterpret_cast<uint16_t*>(inputFrame.buffer);
+        const uint32_t sampleCount = inputFrame.width * inputFrame.height;
+        for (uint32_t sampleIndex = 0; sampleIndex < sampleCount; ++sampleIndex) {
+            // Left half is a 400 cd/m2 grey, right half the 1000 cd/m2 peak
+            const bool isPeak = sampleIndex % inputFrame.width >= inputFrame.width / 2;
+            inputSamples[sampleIndex] = isPeak ? 769 : 668;
+        }
+        std::fill_n(inputSamples + sampleCount, sampleCount * 2, static_cast<uint16_t>(512));
+        VideoFrameWrapper outputFrame = CreateFrame(PixelFormat::RGB8BitInterleavedRGBA, 64, 16);
+        std::cout << "Testing tone mapping" << std::endl;
+        if (toneMappingVideoConverter->Convert(inputFrame, outputFrame) != Result::Success) {
+            std::cout << "Error converting" << std::endl;
+            return -1;
+        }
+        for (uint32_t pixelIndex = 0; pixelIndex < sampleCount; ++pixelIndex) {
+            const bool isPeak = pixelIndex % inputFrame.width >= inputFrame.width / 2;
+            const uint8_t sample = outputFrame.buffer[pixelIndex * 4];
+            if (isPeak ? sample < 254 : (sample < 200 || sample > 252)) {
+                std::cout << "Highlights weren't tone mapped as expected" << std::endl;
+                return -1;
+            }
+        }
+        delete[] outputFrame.buffer;
+        delete[] inputFrame.buffer;
+        toneMappingVideoConverter->Release();
+    }
+
+    // Ordered dithering keeps the mean of a flat 10-bit area when it falls between two 8-bit codes, in single and half
+    // precision, and leaves conversions that don't lose precision untouched
+    for (const bool allowFloat16Arithmetic : {false, true}) {
+        VideoConverterConfig ditheringConfig;
+        ditheringConfig.dithering = Dithering::Ordered;
+        ditheringConfig.allowFloat16Arithmetic = allowFloat16Arithmetic;
+        const auto ditheringVideoConverter = device->CreateVideoConverter(ditheringConfig);
+
+        VideoFrameWrapper inputFrame = CreateFrame(PixelFormat::YCC10Bit444Planar, 64, 16);
+        inputFrame.isVideoFullRange = true;
+        uint16_t* inputSamples = reinterpret_cast<uint16_t*>(inputFrame.buffer);
+        const uint32_t sampleCount = inputFrame.width * inputFrame.height;
+        std::fill_n(inputSamples, sampleCount, static_cast<uint16_t>(513));
+        std::fill_n(inputSamples + sampleCount, sampleCount * 2, static_cast<uint16_t>(512));
+        VideoFrameWrapper outputFrame = CreateFrame(PixelFormat::YCC8Bit444Planar, 64, 16);
+        outputFrame.isVideoFullRange = true;
+        outputFrame.lumaChromaMatrix = inputFrame.lumaChromaMatrix;
+        std::cout << "Testing dithering" << (allowFloat16Arithmetic ? " with half precision" : "") << std::endl;
+        if (ditheringVideoConverter->Convert(inputFrame, outputFrame) != Result::Success) {
+            std::cout << "Error converting" << std::endl;
+            return -1;
+        }
+        uint32_t lumaSum = 0;
+        for (uint32_t sampleIndex = 0; sampleIndex < sampleCount; ++sampleIndex) {
+            lumaSum += outputFrame.buffer[sampleIndex];
+        }
+        const double expectedMean = 513.0 * 255.0 / 1023.0;
+        if (std::abs(static_cast<double>(lumaSum) / sampleCount - expectedMean) > 0.05) {
+            std::cout << "Dithered samples don't average to the source level" << std::endl;
+            return -1;
+        }
+
+        // 8-bit samples map onto 10-bit codes without loss, so every sample gets the same code
+        std::fill_n(outputFrame.buffer, outputFrame.GetBufferSize(), static_cast<uint8_t>(100));
+        if (ditheringVideoConverter->Convert(outputFrame, inputFrame) != Result::Success) {
+            std::cout << "Error converting" << std::endl;
+            return -1;
+        }
+        const uint16_t expectedSample = static_cast<uint16_t>(std::lround(100.0 * 1023.0 / 255.0));
+        for (uint32_t sampleIndex = 0; sampleIndex < sampleCount * 3; ++sampleIndex) {
+            if (inputSamples[sampleIndex] != expectedSample) {
+                std::cout << "Samples were dithered without losing precision" << std::endl;
+                return -1;
+            }
+        }
+        delete[] outputFrame.buffer;
+        delete[] inputFrame.buffer;
+        ditheringVideoConverter->Release();
+    }
+
+    // A .cube table inverting every channel is applied exactly, its lattice points lying on a linear function
+    {
+        const std::string lutPath = "invert.cube";
+        {
+            std::ofstream lutFile(lutPath);
+            lutFile << "# Inverts every channel" << std::endl << "LUT_3D_SIZE 2" << std::endl;
+            for (uint32_t entryIndex = 0; entryIndex < 2 * 2 * 2; ++entryIndex) {
+                // Red varies fastest
+                const uint32_t red = entryIndex % 2;
+                const uint32_t green = entryIndex / 2 % 2;
+                const uint32_t blue = entryIndex / 4;
+                lutFile << 1 - red << " " << 1 - green << " " << 1 - blue << std::endl;
+            }
+        }
+        auto [lutResult, colorLUT] = ColorLUT::LoadCube(lutPath);
+        std::remove(lutPath.c_str());
+        if (lutResult != Result::Success) {
+            std::cout << "Error loading color LUT" << std::endl;
+            return -1;
+        }
+        VideoConverterConfig lutConfig;
+        lutConfig.colorLUT = colorLUT;
+        const auto lutVideoConverter = device->CreateVideoConverter(lutConfig);
+
+        VideoFrameWrapper inputFrame = CreateFrame(PixelFormat::RGB8BitInterleavedRGBA, 64, 16);
+        for (uint32_t pixelIndex = 0; pixelIndex < inputFrame.width * inputFrame.height; ++pixelIndex) {
+            inputFrame.buffer[pixelIndex * 4] = static_cast<uint8_t>(pixelIndex);
+            inputFrame.buffer[pixelIndex * 4 + 1] = static_cast<uint8_t>(pixelIndex * 3);
+            inputFrame.buffer[pixelIndex * 4 + 2] = static_cast<uint8_t>(pixelIndex * 7);
+        }
+        VideoFrameWrapper outputFrame = CreateFrame(PixelFormat::RGB8BitInterleavedRGBA, 64, 16);
+        std::cout << "Testing color LUT" << std::endl;
+        if (lutVideoConverter->Convert(inputFrame, outputFrame) != Result::Success) {
+            std::cout << "Error converting" << std::endl;
+            return -1;
+        }
+        for (uint32_t pixelIndex = 0; pixelIndex < inputFrame.width * inputFrame.height; ++pixelIndex) {
+            for (uint32_t channel = 0; channel < 3; ++channel) {
+                const int expectedSample = 255 - inputFrame.buffer[pixelIndex * 4 + channel];
+                if (std::abs(outputFrame.buffer[pixelIndex * 4 + channel] - expectedSample) > 1) {
+                    std::cout << "Color LUT wasn't applied as expected" << std::endl;
+                    return -1;
+                }
+            }
+        }
+        delete[] outputFrame.buffer;
+        delete[] inputFrame.buffer;
+        lutVideoConverter->Release();
+    }
+
+    // Planar and biplanar layouts with the same sampling and bit depth are repacked without color math, so a round trip
+    // through the biplanar format gives back every sample
+    for (const auto& [planarFormat, biplanarFormat] :
+         {std::pair{PixelFormat::YCC8Bit420Planar, PixelFormat::YCC8Bit420BiplanarNV12},
+          std::pair{PixelFormat::YCC10Bit420Planar, PixelFormat::YCC10Bit420BiplanarP010}}) {
+        VideoFrameWrapper inputFrame = CreateFrame(planarFormat, 64, 32);
+        const uint32_t byteDepth = inputFrame.GetByteDepth();
+        const uint32_t maxSample = (1u << inputFrame.GetBitDepth()) - 1;
+        // Luma, Cb and Cr planes with their offset, stride and size
+        struct Plane {
+            uint32_t offset, stride, width, height;
+        };
+        const std::vector<Plane> planes{
+            {0, inputFrame.stride, inputFrame.width, inputFrame.height},
+            {inputFrame.GetCbOffset(),
+             inputFrame.GetChromaStride(),
+             inputFrame.GetChromaWidth(),
+             inputFrame.GetChromaHeight()},
+            {inputFrame.GetCrOffset(),
+             inputFrame.GetChromaStride(),
+             inputFrame.GetChromaWidth(),
+             inputFrame.GetChromaHeight()},
+        };
+        const auto getSample = [byteDepth](const VideoFrameWrapper& frame, const Plane& plane, uint32_t x, uint32_t y) {
+            const uint8_t* sample = frame.buffer + plane.offset + y * plane.stride + x * byteDepth;
+            return byteDepth == 1 ? *sample : *reinterpret_cast<const uint16_t*>(sample);
+        };
+        for (size_t planeIndex = 0; planeIndex < planes.size(); ++planeIndex) {
+            const Plane& plane = planes[planeIndex];
+            for (uint32_t y = 0; y < plane.height; ++y) {
+                for (uint32_t x = 0; x < plane.width; ++x) {
+                    const uint32_t sample = (x * 5 + y * 11 + static_cast<uint32_t>(planeIndex) * 50) * 3 % maxSample;
+                    uint8_t* samplePointer = inputFrame.buffer + plane.offset + y * plane.stride + x * byteDepth;
+                    if (byteDepth == 1) {
+                        *samplePointer = static_cast<uint8_t>(sample);
+                    } else {
+                        *reinterpret_cast<uint16_t*>(samplePointer) = static_cast<uint16_t>(sample);
+                    }
+                }
+            }
+        }
+        VideoFrameWrapper biplanarFrame = CreateFrame(biplanarFormat, inputFrame.width, inputFrame.height);
+        VideoFrameWrapper outputFrame = CreateFrame(planarFormat, inputFrame.width, inputFrame.height);
+        for (VideoFrameWrapper* frame : {&biplanarFrame, &outputFrame}) {
+            frame->isVideoFullRange = inputFrame.isVideoFullRange;
+            frame->lumaChromaMatrix = inputFrame.lumaChromaMatrix;
+        }
+        std::cout << "Testing repack round trip: " << GetFormatName(planarFormat) << " through "
+                  << GetFormatName(biplanarFormat) << std::endl;
+        if (videoConverter->Convert(inputFrame, biplanarFrame) != Result::Success ||
+            videoConverter->Convert(biplanarFrame, outputFrame) != Result::Success) {
+            std::cout << "Error converting" << std::endl;
+            return -1;
+        }
+        for (const Plane& plane : planes) {
+            for (uint32_t y = 0; y < plane.height; ++y) {
+                for (uint32_t x = 0; x < plane.width; ++x) {
+                    if (getSample(inputFrame, plane, x, y) != getSample(outputFrame, plane, x, y)) {
+                        std::cout << "Repacked samples changed" << std::endl;
+                        return -1;
+                    }
+                }
+            }
+        }
+        delete[] outputFrame.buffer;
+        delete[] biplanarFrame.buffer;
+        delete[] inputFrame.buffer;
+    }
+
+    // Scaling from sampled images must stay within 1 LSB of filtering from storage buffers
+    {
+        VideoConverterConfig bufferPathConfig;
+        bufferPathConfig.allowSampledImages = false;
+        const auto bufferPathVideoConverter = device->CreateVideoConverter(bufferPathConfig);
+
+        VideoFrameWrapper gradientFrame = GetGradient44410BitFrame(256, 256);
+        for (PixelFormat inputFormat : {PixelFormat::RGB8BitInterleavedRGBA,
+                                        PixelFormat::YCC8Bit420Planar,
+                                        PixelFormat::YCC8Bit420BiplanarNV12,
+                                        PixelFormat::YCC10Bit420BiplanarP010}) {
+            VideoFrameWrapper inputFrame = CreateFrame(inputFormat, gradientFrame.width, gradientFrame.height);
+            VideoFrameWrapper outputFrame = CreateFrame(PixelFormat::YCC10Bit444Planar, 200, 120);
+            VideoFrameWrapper referenceFrame = CreateFrame(PixelFormat::YCC10Bit444Planar, 200, 120);
+            std::cout << "Testing sampled image scaling: " << GetFormatName(inputFormat) << std::endl;
+            if (videoConverter->Convert(gradientFrame, inputFrame) != Result::Success) {
+                std::cout << "Error converting" << std::endl;
+                return -1;
+            }
+            const auto [sampledResult, sampledBenchmark] =
+                videoConverter->ConvertWithBenchmark(inputFrame, outputFrame);
+            const auto [bufferResult, bufferBenchmark] =
+                bufferPathVideoConverter->ConvertWithBenchmark(inputFrame, referenceFrame);
+            if (sampledResult != Result::Success || bufferResult != Result::Success) {
+                std::cout << "Error converting" << std::endl;
+                return -1;
+            }
+            if (!sampledBenchmark.usedSampledImages) {
+                std::cout << "Skipping, the device can't filter " << GetFormatName(inputFormat) << " planes"
+                          << std::endl;
+            } else if (bufferBenchmark.usedSampledImages) {
+                std::cout << "Sampled images were used although they weren't allowed" << std::endl;
+                return -1;
+            } else {
+                const uint16_t* samples = reinterpret_cast<const uint16_t*>(outputFrame.buffer);
+                const uint16_t* referenceSamples = reinterpret_cast<const uint16_t*>(referenceFrame.buffer);
+                const uint32_t sampleCount = outputFrame.GetBufferSize() / sizeof(uint16_t);
+                for (uint32_t sampleIndex = 0; sampleIndex < sampleCount; ++sampleIndex) {
+                    if (std::abs(samples[sampleIndex] - referenceSamples[sampleIndex]) > 1) {
+                        std::cout << "Sampled and buffer paths differ by more than 1 LSB" << std::endl;
+                        return -1;
+                    }
+                }
+            }
+            delete[] referenceFrame.buffer;
+            delete[] outputFrame.buffer;
+            delete[] inputFrame.buffer;
+        }
+
+        // Alpha is filtered by the texture units along with the color
+        VideoFrameWrapper alphaFrame = CreateFrame(PixelFormat::RGB8BitInterleavedRGBA, 256, 256);
+        for (uint32_t pixelIndex = 0; pixelIndex < alphaFrame.width * alphaFrame.height; ++pixelIndex) {
+            alphaFrame.buffer[pixelIndex * 4 + 3] = static_cast<uint8_t>(pixelIndex % alphaFrame.width);
+        }
+        VideoFrameWrapper outputFrame = CreateFrame(PixelFormat::RGB8BitInterleavedRGBA, 200, 120);
+        VideoFrameWrapper referenceFrame = CreateFrame(PixelFormat::RGB8BitInterleavedRGBA, 200, 120);
+        std::cout << "Testing sampled image scaling: alpha" << std::endl;
+        const auto [sampledResult, sampledBenchmark] = videoConverter->ConvertWithBenchmark(alphaFrame, outputFrame);
+        if (sampledResult != Result::Success ||
+            bufferPathVideoConverter->Convert(alphaFrame, referenceFrame) != Result::Success) {
+            std::cout << "Error converting" << std::endl;
+            return -1;
+        }
+        if (!sampledBenchmark.usedSampledImages) {
+            std::cout << "Skipping, the device can't filter RGBA planes" << std::endl;
+        } else {
+            for (uint32_t pixelIndex = 0; pixelIndex < outputFrame.width * outputFrame.height; ++pixelIndex) {
+                if (std::abs(outputFrame.buffer[pixelIndex * 4 + 3] - referenceFrame.buffer[pixelIndex * 4 + 3]) > 1) {
+                    std::cout << "Sampled and buffer alpha differ by more than 1 LSB" << std::endl;
+                    return -1;
+                }
+            }
+        }
+        delete[] referenceFrame.buffer;
+        delete[] outputFrame.buffer;
+        delete[] alphaFrame.buffer;
+        delete[] gradientFrame.buffer;
+        bufferPathVideoConverter->Release();
+    }
+
+    // Half precision path must stay within 1 LSB of the single precision one
+    if (!device->SupportsFloat16Arithmetic()) {
+        std::cout << "Skipping half precision accuracy test, shaderFloat16 isn't supported" << std::endl;
+    } else {
+        VideoConverterConfig float32Config;
+        float32Config.allowFloat16Arithmetic = false;
+        const auto float32VideoConverter = device->CreateVideoConverter(float32Config);
+
+        std::vector<PixelFormat> accuracyOutputFormats{
+            PixelFormat::YCC10Bit420Planar,
+            PixelFormat::YCC10Bit422Planar,
+            PixelFormat::YCC10Bit444Planar,
+        };
+        std::vector<Resolution> accuracyResolutions{Resolution{256, 256}, Resolution{200, 120}};
+
+        VideoFrameWrapper inputFrame = GetGradient44410BitFrame(256, 256);
+        for (Resolution outputResolution : accuracyResolutions) {
+            for (PixelFormat outputFormat : accuracyOutputFormats) {
+                for (bool outputVideoFullRange : {false, true}) {
+                    for (LumaChromaMatrix outputMatrix : matrices) {
+                        VideoFrameWrapper outputFrame =
+                            CreateFrame(outputFormat, outputResolution.width, outputResolution.height);
+                        outputFrame.isVideoFullRange = outputVideoFullRange;
+                        outputFrame.lumaChromaMatrix = outputMatrix;
+                        VideoFrameWrapper referenceFrame =
+                            CreateFrame(outputFormat, outputResolution.width, outputResolution.height);
+                        referenceFrame.isVideoFullRange = outputVideoFullRange;
+                        referenceFrame.lumaChromaMatrix = outputMatrix;
+
+                        std::cout << "Testing accuracy:" << std::endl
+                                  << "\t Output: " << outputFrame.width << "x" << outputFrame.height << "("
+                                  << GetFormatName(outputFrame.pixelFormat) << ","
+                                  << GetRangeName(outputFrame.isVideoFullRange) << ","
+                                  << GetYUVMatrixName(outputFrame.lumaChromaMatrix) << ")" << std::endl;
+
+                        if (videoConverter->Convert(inputFrame, outputFrame) != Result::Success ||
+                            float32VideoConverter->Convert(inputFrame, referenceFrame) != Result::Success) {
+                            std::cout << "Error converting" << std::endl;
+                            return -1;
+                        }
+
+                        const uint16_t* samples = reinterpret_cast<const uint16_t*>(outputFrame.buffer);
+                        const uint16_t* referenceSamples = reinterpret_cast<const uint16_t*>(referenceFrame.buffer);
+                        const uint32_t sampleCount = outputFrame.GetBufferSize() / sizeof(uint16_t);
+                        for (uint32_t sampleIndex = 0; sampleIndex < sampleCount; ++sampleIndex) {
+                            if (std::abs(samples[sampleIndex] - referenceSamples[sampleIndex]) > 1) {
+                                std::cout << "Frames differ by more than 1 LSB" << std::endl;
+                                return -1;
+                            }
+                        }
+                        delete[] referenceFrame.buffer;
+                        delete[] outputFrame.buffer;
+                    }
+                }
+            }
+        }
+        delete[] inputFrame.buffer;
+        float32VideoConverter->Release();
+    }
+
+    // Subgroup quad path must match the per-block path
+    if (!device->SupportsSubgroupQuadOperations()) {
+        std::cout << "Skipping subgroup path test, subgroup quad operations aren't supported" << std::endl;
+    } else {
+        VideoConverterConfig blockConfig;
+        blockConfig.allowSubgroupOperations = false;
+        const auto blockVideoConverter = device->CreateVideoConverter(blockConfig);
+
+        VideoFrameWrapper inputFrame = GetGradient44410BitFrame(256, 256);
+        for (Resolution outputResolution : {Resolution{256, 256}, Resolution{200, 120}}) {
+            for (PixelFormat outputFormat : validOutputFormats) {
+                VideoFrameWrapper outputFrame =
+                    CreateFrame(outputFormat, outputResolution.width, outputResolution.height);
+                VideoFrameWrapper referenceFrame =
+                    CreateFrame(outputFormat, outputResolution.width, outputResolution.height);
+
+                std::cout << "Testing subgroup path:" << std::endl
+                          << "\t Output: " << outputFrame.width << "x" << outputFrame.height << "("
+                          << GetFormatName(outputFrame.pixelFormat) << ")" << std::endl;
+
+                if (videoConverter->Convert(inputFrame, outputFrame) != Result::Success ||
+                    blockVideoConverter->Convert(inputFrame, referenceFrame) != Result::Success) {
+                    std::cout << "Error converting" << std::endl;
+                    return -1;
+                }
+                if (memcmp(outputFrame.buffer, referenceFrame.buffer, outputFrame.GetBufferSize()) != 0) {
+                    std::cout << "Frames aren't equal" << std::endl;
+                    return -1;
+                }
+                delete[] referenceFrame.buffer;
+                delete[] outputFrame.buffer;
+            }
+        }
+        delete[] inputFrame.buffer;
+        blockVideoConverter->Release();
+    }
+
+    // Scaler weights are normalized, so flat frames must scale to the same output as bilinear filtering
+    for (ScalingFilter scalingFilter : {ScalingFilter::Bicubic, ScalingFilter::Lanczos3, ScalingFilter::Area}) {
+        VideoConverterConfig scalerConfig;
+        scalerConfig.scalingFilter = scalingFilter;
+        const auto scalerVideoConverter = device->CreateVideoConverter(scalerConfig);
+
+        VideoFrameWrapper inputFrame = CreateFrame(PixelFormat::YCC10Bit444Planar, 256, 256);
+        uint16_t* inputSamples = reinterpret_cast<uint16_t*>(inputFrame.buffer);
+        const uint32_t planeSize = inputFrame.width * inputFrame.height;
+        std::fill_n(inputSamples, planeSize, static_cast<uint16_t>(512));
+        std::fill_n(inputSamples + planeSize, planeSize, static_cast<uint16_t>(300));
+        std::fill_n(inputSamples + planeSize * 2, planeSize, static_cast<uint16_t>(700));
+        for (Resolution outputResolution :
+             {Resolution{64, 64}, Resolution{128, 85}, Resolution{200, 120}, Resolution{400, 300}}) {
+            for (PixelFormat outputFormat : validOutputFormats) {
+                VideoFrameWrapper outputFrame =
+                    CreateFrame(outputFormat, outputResolution.width, outputResolution.height);
+                VideoFrameWrapper referenceFrame =
+                    CreateFrame(outputFormat, outputResolution.width, outputResolution.height);
+
+                std::cout << "Testing separable scaler:" << std::endl
+                          << "\t Output: " << outputFrame.width << "x" << outputFrame.height << "("
+                          << GetFormatName(outputFrame.pixelFormat) << ")" << std::endl;
+
+                if (scalerVideoConverter->Convert(inputFrame, outputFrame) != Result::Success ||
+                    videoConverter->Convert(inputFrame, referenceFrame) != Result::Success) {
+                    std::cout << "Error converting" << std::endl;
+                    return -1;
+                }
+                if (memcmp(outputFrame.buffer, referenceFrame.buffer, outputFrame.GetBufferSize()) != 0) {
+                    std::cout << "Frames aren't equal" << std::endl;
+                    return -1;
+                }
+                delete[] referenceFrame.buffer;
+                delete[] outputFrame.buffer;
+            }
+        }
+        delete[] inputFrame.buffer;
+        scalerVideoConverter->Release();
+    }
+
+    // Integer area reductions average whole source blocks, rounding half up
+    {
+        VideoConverterConfig areaConfig;
+        areaConfig.scalingFilter = ScalingFilter::Area;
+        const auto areaVideoConverter = device->CreateVideoConverter(areaConfig);
+
+        VideoFrameWrapper inputFrame = CreateFrame(PixelFormat::YCC8Bit444Planar, 24, 24);
+        const uint32_t planeSize = inputFrame.width * inputFrame.height;
+        std::fill_n(inputFrame.buffer + planeSize, planeSize * 2, static_cast<uint8_t>(128));
+        for (uint32_t y = 0; y < inputFrame.height; ++y) {
+            for (uint32_t x = 0; x < inputFrame.width; ++x) {
+                inputFrame.buffer[y * inputFrame.stride + x] = static_cast<uint8_t>(40 + (x * 7 + y * 3) % 120);
+            }
+        }
+        for (uint32_t ratio : {2u, 3u, 4u}) {
+            VideoFrameWrapper outputFrame =
+                CreateFrame(PixelFormat::YCC8Bit444Planar, inputFrame.width / ratio, inputFrame.height / ratio);
+            std::cout << "Testing area scaling: " << ratio << "x" << std::endl;
+            if (areaVideoConverter->Convert(inputFrame, outputFrame) != Result::Success) {
+                std::cout << "Error converting" << std::endl;
+                return -1;
+            }
+            for (uint32_t y = 0; y < outputFrame.height; ++y) {
+                for (uint32_t x = 0; x < outputFrame.width; ++x) {
+                    uint32_t sum = 0;
+                    for (uint32_t boxY = 0; boxY < ratio; ++boxY) {
+                        for (uint32_t boxX = 0; boxX < ratio; ++boxX) {
+                            sum += inputFrame.buffer[(y * ratio + boxY) * inputFrame.stride + x * ratio + boxX];
+                        }
+                    }
+                    const uint32_t expectedSample = (sum + ratio * ratio / 2) / (ratio * ratio);
+                    if (outputFrame.buffer[y * outputFrame.stride + x] != expectedSample) {
+                        std::cout << "Area scaling isn't the block average" << std::endl;
+                        return -1;
+                    }
+                }
+            }
+            delete[] outputFrame.buffer;
+        }
+        delete[] inputFrame.buffer;
+
+        // Reducing 24 columns alternating 40 and 160 to 10 spans 2.4 source pixels per destination pixel, partially
+        // covered pixels weigh their coverage: (40 + 160 + 0.4 * 40) / 2.4 = 90 for the first destination pixel and
+        // (0.2 * 40 + 160 + 40 + 0.2 * 160) / 2.4 = 100 for the third
+        VideoFrameWrapper columnsFrame = CreateFrame(PixelFormat::YCC8Bit444Planar, 24, 4);
+        const uint32_t columnsPlaneSize = columnsFrame.width * columnsFrame.height;
+        std::fill_n(columnsFrame.buffer + columnsPlaneSize, columnsPlaneSize * 2, static_cast<uint8_t>(128));
+        for (uint32_t y = 0; y < columnsFrame.height; ++y) {
+            for (uint32_t x = 0; x < columnsFrame.width; ++x) {
+                columnsFrame.buffer[y * columnsFrame.stride + x] = x % 2 == 0 ? 40 : 160;
+            }
+        }
+        VideoFrameWrapper outputFrame = CreateFrame(PixelFormat::YCC8Bit444Planar, 10, 4);
+        std::cout << "Testing area scaling: 2.4x" << std::endl;
+        if (areaVideoConverter->Convert(columnsFrame, outputFrame) != Result::Success) {
+            std::cout << "Error converting" << std::endl;
+            return -1;
+        }
+        const std::vector<int> expectedSamples{90, 90, 100, 110, 110, 90, 90, 100, 110, 110};
+        for (uint32_t y = 0; y < outputFrame.height; ++y) {
+            for (uint32_t x = 0; x < outputFrame.width; ++x) {
+                if (std::abs(outputFrame.buffer[y * outputFrame.stride + x] - expectedSamples[x]) > 1) {
+                    std::cout << "Area scaling doesn't weigh pixels by coverage" << std::endl;
+                    return -1;
+                }
+            }
+        }
+        delete[] outputFrame.buffer;
+        delete[] columnsFrame.buffer;
+        areaVideoConverter->Release();
+    }
+
+    // An impulse over a flat line upscaled 2x spreads over the filter taps at phases 0.25 and 0.75, undershooting on
+    // both sides of the peak. Expected luma is `100 + 100 * w`, with Keys weights 0.8672, 0.2266, -0.0703, -0.0234 and
+    // normalized Lanczos3 weights 0.8928, 0.2710, -0.1333, -0.0680, 0.0301, 0.0074 from the center out.
+    const std::vector<std::pair<ScalingFilter, std::vector<int>>> impulseResponses{
+        {ScalingFilter::Bicubic, {100, 100, 98, 93, 123, 187, 187, 123, 93, 98, 100, 100}},
+        {ScalingFilter::Lanczos3, {101, 103, 93, 87, 127, 189, 189, 127, 87, 93, 103, 101}},
+    };
+    for (const auto& [scalingFilter, expectedSamples] : impulseResponses) {
+        VideoConverterConfig scalerConfig;
+        scalerConfig.scalingFilter = scalingFilter;
+        const auto scalerVideoConverter = device->CreateVideoConverter(scalerConfig);
+
+        VideoFrameWrapper inputFrame = CreateFrame(PixelFormat::YCC8Bit444Planar, 16, 4);
+        const uint32_t planeSize = inputFrame.width * inputFrame.height;
+        std::fill_n(inputFrame.buffer, planeSize, static_cast<uint8_t>(100));
+        std::fill_n(inputFrame.buffer + planeSize, planeSize * 2, static_cast<uint8_t>(128));
+        for (uint32_t y = 0; y < inputFrame.height; ++y) {
+            inputFrame.buffer[y * inputFrame.stride + 8] = 200;
+        }
+        VideoFrameWrapper outputFrame = CreateFrame(PixelFormat::YCC8Bit444Planar, 32, 4);
+        std::cout << "Testing scaler impulse response" << std::endl;
+        if (scalerVideoConverter->Convert(inputFrame, outputFrame) != Result::Success) {
+            std::cout << "Error converting" << std::endl;
+            return -1;
+        }
+        // Destination pixels 11 to 22 are within reach of the impulse
+        constexpr uint32_t firstExpectedX = 11;
+        for (uint32_t y = 0; y < outputFrame.height; ++y) {
+            for (uint32_t x = 0; x < outputFrame.width; ++x) {
+                const bool isNearImpulse = x >= firstExpectedX && x < firstExpectedX + expectedSamples.size();
+                const int expectedSample = isNearImpulse ? expectedSamples[x - firstExpectedX] : 100;
+                if (std::abs(outputFrame.buffer[y * outputFrame.stride + x] - expectedSample) > 1) {
+                    std::cout << "Impulse response doesn't match the filter weights" << std::endl;
+                    return -1;
+                }
+            }
+        }
+        delete[] outputFrame.buffer;
+        delete[] inputFrame.buffer;
+        scalerVideoConverter->Release();
+    }
+
     videoConverter->Release();
     device->Release();
     return 0;